@@ -0,0 +1,72 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file idle.cpp
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// GBenchmark
+#include <benchmark/benchmark.h>
+
+// Parachute
+#include <parachute/pool.hpp>
+
+using namespace para;
+
+
+/**
+ * @brief Measures latency, from submission to start, of single jobs submitted to an idle pool
+ *
+ * Each iteration waits <code>range(0)</code> microseconds, so that workers have gone idle (spinning, yielding or
+ * parked, depending on the pool's idle policy), then submits one job, and waits for it to run. Reports p50 and p99
+ * submit-to-start latency, in microseconds.
+ */
+template <typename PoolT> static void BM_SubmitToStart(benchmark::State& state)
+{
+  using clock = std::chrono::steady_clock;
+
+  const std::chrono::microseconds gap{ state.range(0) };
+
+  std::vector<double> latencies_us;
+  latencies_us.reserve(1 << 16);
+
+  PoolT wp;
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    std::this_thread::sleep_for(gap);
+    state.ResumeTiming();
+
+    std::atomic<bool> started = false;
+    clock::time_point start_time;
+    const auto submitted = clock::now();
+    wp.emplace([&started, &start_time] {
+      start_time = clock::now();
+      started.store(true, std::memory_order_release);
+    });
+    while (!started.load(std::memory_order_acquire))
+    {
+      std::this_thread::yield();
+    }
+    latencies_us.push_back(std::chrono::duration<double, std::micro>(start_time - submitted).count());
+  }
+
+  std::sort(latencies_us.begin(), latencies_us.end());
+  state.counters["p50_us"] = latencies_us[latencies_us.size() / 2];
+  state.counters["p99_us"] = latencies_us[(latencies_us.size() * 99) / 100];
+}
+
+
+using pool_stealing_spinning = pool_base<work_group_dynamic, work_queue_stealing<>, work_control_idle<idle_spin<>>>;
+
+BENCHMARK_TEMPLATE(BM_SubmitToStart, pool)->Arg(0)->Arg(50)->Arg(1000)->Iterations(2000);
+BENCHMARK_TEMPLATE(BM_SubmitToStart, pool_spinning)->Arg(0)->Arg(50)->Arg(1000)->Iterations(2000);
+BENCHMARK_TEMPLATE(BM_SubmitToStart, pool_stealing)->Arg(0)->Arg(50)->Arg(1000)->Iterations(2000);
+BENCHMARK_TEMPLATE(BM_SubmitToStart, pool_stealing_spinning)->Arg(0)->Arg(50)->Arg(1000)->Iterations(2000);
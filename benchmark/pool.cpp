@@ -0,0 +1,112 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file pool.cpp
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+// GBenchmark
+#include <benchmark/benchmark.h>
+
+// Parachute
+#include <parachute/pool.hpp>
+
+using namespace para;
+
+
+/**
+ * @brief Waits until \c counter reaches \c target
+ */
+static void spin_until(const std::atomic<std::size_t>& counter, const std::size_t target)
+{
+  while (counter.load(std::memory_order_acquire) < target)
+  {
+    std::this_thread::yield();
+  }
+}
+
+
+/**
+ * @brief Enqueues empty tasks from a thread which is not a worker
+ */
+template <typename PoolT> static void BM_EmplaceThroughput(benchmark::State& state)
+{
+  const auto n_tasks = static_cast<std::size_t>(state.range(0));
+
+  PoolT wp;
+
+  for (auto _ : state)
+  {
+    std::atomic<std::size_t> completed = 0;
+    for (std::size_t i = 0; i < n_tasks; ++i)
+    {
+      wp.emplace([&completed] { completed.fetch_add(1, std::memory_order_release); });
+    }
+    spin_until(completed, n_tasks);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n_tasks);
+}
+
+
+/**
+ * @brief Baseline for <code>BM_EmplaceThroughput</code>: launches each empty task with <code>std::async</code>
+ */
+static void BM_StdAsyncThroughput(benchmark::State& state)
+{
+  const auto n_tasks = static_cast<std::size_t>(state.range(0));
+
+  std::vector<std::future<void>> tasks;
+  tasks.reserve(n_tasks);
+  for (auto _ : state)
+  {
+    std::atomic<std::size_t> completed = 0;
+    for (std::size_t i = 0; i < n_tasks; ++i)
+    {
+      tasks.push_back(
+        std::async(std::launch::async, [&completed] { completed.fetch_add(1, std::memory_order_release); }));
+    }
+    spin_until(completed, n_tasks);
+    tasks.clear();
+  }
+
+  state.SetItemsProcessed(state.iterations() * n_tasks);
+}
+
+
+/**
+ * @brief Enqueues empty tasks from within a worker, as nested parallel work would
+ */
+template <typename PoolT> static void BM_NestedEmplaceThroughput(benchmark::State& state)
+{
+  const auto n_tasks = static_cast<std::size_t>(state.range(0));
+
+  PoolT wp;
+
+  for (auto _ : state)
+  {
+    std::atomic<std::size_t> completed = 0;
+    wp.emplace([&wp, &completed, n_tasks] {
+      for (std::size_t i = 0; i < n_tasks; ++i)
+      {
+        wp.emplace([&completed] { completed.fetch_add(1, std::memory_order_release); });
+      }
+    });
+    spin_until(completed, n_tasks);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n_tasks);
+}
+
+
+BENCHMARK(BM_StdAsyncThroughput)->RangeMultiplier(8)->Range(64, 1 << 12)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_EmplaceThroughput, pool)->RangeMultiplier(8)->Range(64, 1 << 15)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_EmplaceThroughput, pool_stealing)->RangeMultiplier(8)->Range(64, 1 << 15)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_NestedEmplaceThroughput, pool)->RangeMultiplier(8)->Range(64, 1 << 15)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_NestedEmplaceThroughput, pool_stealing)->RangeMultiplier(8)->Range(64, 1 << 15)->UseRealTime();
@@ -0,0 +1,115 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file post.cpp
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <future>
+#include <new>
+
+// GBenchmark
+#include <benchmark/benchmark.h>
+
+// Parachute
+#include <parachute/non_blocking_future.hpp>
+#include <parachute/pool.hpp>
+#include <parachute/post.hpp>
+
+using namespace para;
+
+
+/// Number of calls to global operator new (aligned or not), from any thread
+static std::atomic<std::size_t> allocation_count = 0;
+
+// Replacements below are paired with one another (malloc / aligned_alloc with free), but g++ cannot see that, and
+// warns that free is called on memory from operator new
+#if defined(__GNUC__) and !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif  // defined(__GNUC__) and !defined(__clang__)
+
+void* operator new(std::size_t size)
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* const ptr = std::malloc(size); ptr != nullptr)
+  {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  const auto align = static_cast<std::size_t>(alignment);
+  // aligned_alloc requires size to be a multiple of alignment
+  if (void* const ptr = std::aligned_alloc(align, ((size + align - 1) / align) * align); ptr != nullptr)
+  {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+
+#if defined(__GNUC__) and !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif  // defined(__GNUC__) and !defined(__clang__)
+
+
+/**
+ * @brief Baseline for <code>BM_PostGet</code>: launches a single task with <code>std::async</code>, then waits for and
+ *        gets its result; reports heap allocations per launch
+ */
+static void BM_StdAsyncGet(benchmark::State& state)
+{
+  const std::size_t allocations_before = allocation_count.load();
+
+  for (auto _ : state)
+  {
+    auto f = std::async(std::launch::async, [] { return 1; });
+    f.wait();
+    benchmark::DoNotOptimize(f.get());
+  }
+
+  state.counters["allocs_per_post"] = benchmark::Counter(
+    static_cast<double>(allocation_count.load() - allocations_before) / static_cast<double>(state.iterations()));
+}
+
+
+/**
+ * @brief Posts a single task, then waits for and gets its result; reports heap allocations per post
+ */
+template <typename PoolT, template <typename> class PromiseTmpl> static void BM_PostGet(benchmark::State& state)
+{
+  PoolT wp;
+
+  const std::size_t allocations_before = allocation_count.load();
+
+  for (auto _ : state)
+  {
+    auto f = post<PromiseTmpl>(wp, [] { return 1; });
+    f.wait();
+    benchmark::DoNotOptimize(f.get());
+  }
+
+  state.counters["allocs_per_post"] = benchmark::Counter(
+    static_cast<double>(allocation_count.load() - allocations_before) / static_cast<double>(state.iterations()));
+}
+
+
+BENCHMARK(BM_StdAsyncGet)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PostGet, pool, strategy::blocking)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PostGet, pool, strategy::non_blocking)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PostGet, pool_stealing, strategy::blocking)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PostGet, pool_stealing, strategy::non_blocking)->UseRealTime();
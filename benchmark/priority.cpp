@@ -0,0 +1,100 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file priority.cpp
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// GBenchmark
+#include <benchmark/benchmark.h>
+
+// Parachute
+#include <parachute/pool.hpp>
+
+using namespace para;
+
+
+/// Busy-waits for \c duration, standing in for a chunk of background work
+static void spin_for(const std::chrono::microseconds duration)
+{
+  const auto deadline = std::chrono::steady_clock::now() + duration;
+  while (std::chrono::steady_clock::now() < deadline)
+  {}
+}
+
+
+/**
+ * @brief Measures latency, from enqueue to start, of urgent tasks on a pool saturated with background work
+ *
+ * Each iteration tops the pool up to <code>range(0)</code> queued background jobs of 20us each, then enqueues one
+ * urgent job (at the most urgent level, if the pool supports priorities) and waits for it to start. Reports p50 and
+ * p99 urgent latency, in microseconds.
+ */
+template <typename PoolT> static void BM_UrgentLatency(benchmark::State& state)
+{
+  using clock = std::chrono::steady_clock;
+
+  const auto backlog = static_cast<int>(state.range(0));
+
+  std::atomic<int> queued = 0;
+  std::vector<double> latencies_us;
+  latencies_us.reserve(1 << 16);
+  {
+    PoolT wp;
+
+    for (auto _ : state)
+    {
+      for (int i = queued.load(); i < backlog; ++i)
+      {
+        ++queued;
+        wp.emplace([&queued] {
+          spin_for(std::chrono::microseconds{ 20 });
+          --queued;
+        });
+      }
+
+      std::atomic<bool> started = false;
+      clock::time_point start_time;
+      const auto enqueued = clock::now();
+      auto urgent = [&started, &start_time] {
+        start_time = clock::now();
+        started.store(true, std::memory_order_release);
+      };
+      if constexpr (std::is_same_v<PoolT, pool_priority>)
+      {
+        wp.emplace(urgent, 0);
+      }
+      else
+      {
+        wp.emplace(urgent);
+      }
+      while (!started.load(std::memory_order_acquire))
+      {
+        std::this_thread::yield();
+      }
+      latencies_us.push_back(std::chrono::duration<double, std::micro>(start_time - enqueued).count());
+    }
+
+    // Drain background work before the pool (and the counter it references) go away
+    while (queued.load() > 0)
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  std::sort(latencies_us.begin(), latencies_us.end());
+  state.counters["p50_us"] = latencies_us[latencies_us.size() / 2];
+  state.counters["p99_us"] = latencies_us[(latencies_us.size() * 99) / 100];
+}
+
+
+BENCHMARK_TEMPLATE(BM_UrgentLatency, pool)->Arg(16)->Arg(256)->UseRealTime()->Iterations(2000);
+BENCHMARK_TEMPLATE(BM_UrgentLatency, pool_priority)->Arg(16)->Arg(256)->UseRealTime()->Iterations(2000);
@@ -0,0 +1,76 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file reduce.cpp
+ */
+
+// C++ Standard Library
+#include <functional>
+#include <numeric>
+#include <vector>
+
+// GBenchmark
+#include <benchmark/benchmark.h>
+
+// Parachute
+#include <parachute/algorithm/reduce.hpp>
+#include <parachute/pool.hpp>
+
+using namespace para;
+
+
+static std::vector<double> make_sequence(const benchmark::State& state)
+{
+  std::vector<double> sequence(static_cast<std::size_t>(state.range(0)));
+  std::iota(sequence.begin(), sequence.end(), 0.0);
+  return sequence;
+}
+
+
+static void BM_StdAccumulate(benchmark::State& state)
+{
+  const auto sequence = make_sequence(state);
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(std::accumulate(sequence.begin(), sequence.end(), 0.0));
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+template <typename PoolT> static void BM_Reduce(benchmark::State& state)
+{
+  const auto sequence = make_sequence(state);
+
+  PoolT wp;
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(algorithm::reduce(wp, sequence.begin(), sequence.end(), 0.0));
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+template <typename PoolT> static void BM_ReduceDeterministic(benchmark::State& state)
+{
+  const auto sequence = make_sequence(state);
+
+  PoolT wp;
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(algorithm::reduce(
+      wp, sequence.begin(), sequence.end(), 0.0, std::plus<>{}, algorithm::static_partitioner{ 1 << 14 }));
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+BENCHMARK(BM_StdAccumulate)->RangeMultiplier(16)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_Reduce, pool)->RangeMultiplier(16)->Range(1 << 10, 1 << 24)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ReduceDeterministic, pool)->RangeMultiplier(16)->Range(1 << 10, 1 << 24)->UseRealTime();
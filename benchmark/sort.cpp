@@ -0,0 +1,117 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file sort.cpp
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// GBenchmark
+#include <benchmark/benchmark.h>
+
+// Parachute
+#include <parachute/algorithm/sort.hpp>
+#include <parachute/pool.hpp>
+
+using namespace para;
+
+
+static std::vector<std::uint64_t> make_shuffled(const benchmark::State& state)
+{
+  std::mt19937_64 rng{ 42 };
+  std::vector<std::uint64_t> sequence(static_cast<std::size_t>(state.range(0)));
+  std::generate(sequence.begin(), sequence.end(), rng);
+  return sequence;
+}
+
+
+static void BM_StdSort(benchmark::State& state)
+{
+  const auto original = make_shuffled(state);
+  auto sequence = original;
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    sequence = original;
+    state.ResumeTiming();
+    std::sort(sequence.begin(), sequence.end());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+template <typename PoolT> static void BM_Sort(benchmark::State& state)
+{
+  const auto original = make_shuffled(state);
+  auto sequence = original;
+
+  PoolT wp;
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    sequence = original;
+    state.ResumeTiming();
+    algorithm::sort(wp, sequence.begin(), sequence.end());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+template <typename PoolT> static void BM_StableSort(benchmark::State& state)
+{
+  const auto original = make_shuffled(state);
+  auto sequence = original;
+
+  PoolT wp;
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    sequence = original;
+    state.ResumeTiming();
+    algorithm::stable_sort(wp, sequence.begin(), sequence.end());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+BENCHMARK(BM_StdSort)->RangeMultiplier(16)->Range(1 << 16, 1 << 24)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Sort, static_pool<1>)
+  ->RangeMultiplier(16)
+  ->Range(1 << 16, 1 << 24)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Sort, static_pool<2>)
+  ->RangeMultiplier(16)
+  ->Range(1 << 16, 1 << 24)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Sort, static_pool<4>)
+  ->RangeMultiplier(16)
+  ->Range(1 << 16, 1 << 24)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Sort, static_pool<8>)
+  ->RangeMultiplier(16)
+  ->Range(1 << 16, 1 << 24)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StableSort, static_pool<1>)
+  ->RangeMultiplier(16)
+  ->Range(1 << 16, 1 << 24)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StableSort, static_pool<4>)
+  ->RangeMultiplier(16)
+  ->Range(1 << 16, 1 << 24)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
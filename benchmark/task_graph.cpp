@@ -0,0 +1,114 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file task_graph.cpp
+ */
+
+// C++ Standard Library
+#include <cstddef>
+#include <vector>
+
+// GBenchmark
+#include <benchmark/benchmark.h>
+
+// Parachute
+#include <parachute/pool.hpp>
+#include <parachute/post.hpp>
+#include <parachute/task_graph.hpp>
+
+using namespace para;
+
+
+/// Small, fixed amount of work done by each node
+static void node_work(std::vector<double>& values, const std::size_t id)
+{
+  double v = static_cast<double>(id);
+  for (int i = 0; i < 64; ++i)
+  {
+    v = v * 0.5 + 1.0;
+  }
+  values[id] = v;
+}
+
+
+/**
+ * @brief Runs a layered DAG, <code>range(0)</code> nodes wide and <code>range(1)</code> layers deep, where each node
+ *        depends on two nodes of the previous layer
+ */
+template <typename PoolT> static void BM_TaskGraph(benchmark::State& state)
+{
+  const auto width = static_cast<std::size_t>(state.range(0));
+  const auto depth = static_cast<std::size_t>(state.range(1));
+
+  PoolT wp;
+
+  std::vector<double> values(width * depth);
+
+  task_graph graph;
+  for (std::size_t layer = 0; layer < depth; ++layer)
+  {
+    for (std::size_t i = 0; i < width; ++i)
+    {
+      const std::size_t id = layer * width + i;
+      graph.emplace([&values, id] { node_work(values, id); });
+      if (layer > 0)
+      {
+        graph.precede(id - width, id);
+        graph.precede((layer - 1) * width + (i + 1) % width, id);
+      }
+    }
+  }
+
+  for (auto _ : state)
+  {
+    auto done = graph.run(wp);
+    done.wait();
+    done.get();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+  state.counters["runs"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+
+/**
+ * @brief Runs the same DAG as <code>BM_TaskGraph</code> by posting each layer, and waiting on it before the next
+ */
+template <typename PoolT> static void BM_PostLayers(benchmark::State& state)
+{
+  const auto width = static_cast<std::size_t>(state.range(0));
+  const auto depth = static_cast<std::size_t>(state.range(1));
+
+  PoolT wp;
+
+  std::vector<double> values(width * depth);
+  std::vector<non_blocking_future<void>> futures;
+  futures.reserve(width);
+
+  for (auto _ : state)
+  {
+    for (std::size_t layer = 0; layer < depth; ++layer)
+    {
+      futures.clear();
+      for (std::size_t i = 0; i < width; ++i)
+      {
+        const std::size_t id = layer * width + i;
+        futures.push_back(post<strategy::non_blocking>(wp, [&values, id] { node_work(values, id); }));
+      }
+      for (auto& f : futures)
+      {
+        f.wait();
+        f.get();
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+  state.counters["runs"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+
+BENCHMARK_TEMPLATE(BM_TaskGraph, pool)->Args({ 16, 16 })->Args({ 64, 4 })->Args({ 4, 64 })->UseRealTime();
+BENCHMARK_TEMPLATE(BM_TaskGraph, pool_stealing)->Args({ 16, 16 })->Args({ 64, 4 })->Args({ 4, 64 })->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PostLayers, pool)->Args({ 16, 16 })->Args({ 64, 4 })->Args({ 4, 64 })->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PostLayers, pool_stealing)->Args({ 16, 16 })->Args({ 64, 4 })->Args({ 4, 64 })->UseRealTime();
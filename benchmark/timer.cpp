@@ -0,0 +1,51 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file timer.cpp
+ */
+
+// C++ Standard Library
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+// GBenchmark
+#include <benchmark/benchmark.h>
+
+// Parachute
+#include <parachute/timer.hpp>
+
+using namespace para;
+
+
+/**
+ * @brief Schedules, then cancels, one timer while <code>state.range(0)</code> other timers are pending
+ */
+static void BM_ScheduleCancel(benchmark::State& state)
+{
+  timer_service timers;
+
+  const auto n_pending = static_cast<std::size_t>(state.range(0));
+  std::vector<timer_handle> pending;
+  pending.reserve(n_pending);
+  for (std::size_t i = 0; i < n_pending; ++i)
+  {
+    const auto deadline = timer_service::clock::now() + std::chrono::seconds{ 10 + i % 3600 };
+    pending.push_back(timers.schedule(deadline, timer_service::clock::duration::zero(), [] {}));
+  }
+
+  for (auto _ : state)
+  {
+    const auto deadline = timer_service::clock::now() + std::chrono::seconds{ 10 };
+    auto handle = timers.schedule(deadline, timer_service::clock::duration::zero(), [] {});
+    benchmark::DoNotOptimize(handle.cancel());
+  }
+
+  for (auto& handle : pending)
+  {
+    handle.cancel();
+  }
+}
+
+
+BENCHMARK(BM_ScheduleCancel)->RangeMultiplier(10)->Range(1, 100000);
@@ -0,0 +1,135 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file transform.cpp
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+// GBenchmark
+#include <benchmark/benchmark.h>
+
+// Parachute
+#include <parachute/algorithm/for_each.hpp>
+#include <parachute/algorithm/transform.hpp>
+#include <parachute/pool.hpp>
+
+using namespace para;
+
+
+static std::vector<double> make_sequence(const benchmark::State& state)
+{
+  std::vector<double> sequence(static_cast<std::size_t>(state.range(0)));
+  std::iota(sequence.begin(), sequence.end(), 0.0);
+  return sequence;
+}
+
+
+/// Per-element work, heavy enough that the loop is not bound by memory bandwidth alone
+static double element_op(const double v) { return std::sqrt(v) * std::sin(v); }
+
+
+static void BM_StdTransform(benchmark::State& state)
+{
+  const auto sequence = make_sequence(state);
+  std::vector<double> output(sequence.size());
+
+  for (auto _ : state)
+  {
+    std::transform(sequence.begin(), sequence.end(), output.begin(), element_op);
+    benchmark::DoNotOptimize(output.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+/**
+ * @brief Splits the sequence into one chunk per hardware thread, each transformed by its own <code>std::async</code>
+ */
+static void BM_StdAsyncTransform(benchmark::State& state)
+{
+  const auto sequence = make_sequence(state);
+  std::vector<double> output(sequence.size());
+
+  const std::size_t n_chunks = std::max(1U, std::thread::hardware_concurrency());
+  const std::size_t grain = (sequence.size() + n_chunks - 1) / n_chunks;
+
+  std::vector<std::future<void>> chunks;
+  chunks.reserve(n_chunks);
+  for (auto _ : state)
+  {
+    for (std::size_t first = 0; first < sequence.size(); first += grain)
+    {
+      const std::size_t last = std::min(sequence.size(), first + grain);
+      chunks.push_back(std::async(std::launch::async, [&sequence, &output, first, last] {
+        std::transform(
+          std::next(sequence.begin(), static_cast<std::ptrdiff_t>(first)),
+          std::next(sequence.begin(), static_cast<std::ptrdiff_t>(last)),
+          std::next(output.begin(), static_cast<std::ptrdiff_t>(first)),
+          element_op);
+      }));
+    }
+    for (auto& chunk : chunks)
+    {
+      chunk.wait();
+    }
+    chunks.clear();
+    benchmark::DoNotOptimize(output.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+template <typename PoolT> static void BM_Transform(benchmark::State& state)
+{
+  const auto sequence = make_sequence(state);
+  std::vector<double> output(sequence.size());
+
+  PoolT wp;
+
+  for (auto _ : state)
+  {
+    algorithm::transform(wp, sequence.begin(), sequence.end(), output.begin(), element_op);
+    benchmark::DoNotOptimize(output.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+template <typename PoolT> static void BM_ForEach(benchmark::State& state)
+{
+  auto sequence = make_sequence(state);
+
+  PoolT wp;
+
+  for (auto _ : state)
+  {
+    algorithm::for_each(wp, sequence.begin(), sequence.end(), [](double& v) { v = element_op(v); });
+    benchmark::DoNotOptimize(sequence.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+BENCHMARK(BM_StdTransform)->RangeMultiplier(16)->Range(1 << 10, 1 << 22)->UseRealTime();
+BENCHMARK(BM_StdAsyncTransform)->RangeMultiplier(16)->Range(1 << 10, 1 << 22)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Transform, static_pool<1>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Transform, static_pool<2>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Transform, static_pool<4>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Transform, static_pool<8>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ForEach, static_pool<1>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ForEach, static_pool<2>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ForEach, static_pool<4>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ForEach, static_pool<8>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22)->UseRealTime();
@@ -0,0 +1,49 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file work_queue.cpp
+ */
+
+// C++ Standard Library
+#include <memory>
+
+// GBenchmark
+#include <benchmark/benchmark.h>
+
+// Parachute
+#include <parachute/pool.hpp>
+
+using namespace para;
+
+
+/**
+ * @brief Measures per-task submission latency with several threads enqueuing to one pool at once
+ */
+template <typename PoolT> static void BM_ConcurrentEmplace(benchmark::State& state)
+{
+  // Shared between all benchmark threads; loop entry and exit are synchronized by the benchmark library
+  static std::unique_ptr<PoolT> wp;
+  if (state.thread_index() == 0)
+  {
+    wp = std::make_unique<PoolT>();
+  }
+
+  for (auto _ : state)
+  {
+    wp->emplace([] {});
+  }
+
+  if (state.thread_index() == 0)
+  {
+    wp.reset();
+  }
+}
+
+
+using pool_lifo = pool_base<work_group_dynamic, work_queue_lifo<>, work_control_default>;
+using pool_fifo = pool_base<work_group_dynamic, work_queue_fifo<>, work_control_default>;
+using pool_ring = pool_base<work_group_dynamic, work_queue_ring<1024>, work_control_default>;
+
+BENCHMARK_TEMPLATE(BM_ConcurrentEmplace, pool_lifo)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentEmplace, pool_fifo)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentEmplace, pool_ring)->ThreadRange(1, 16)->UseRealTime();
@@ -7,4 +7,8 @@
 
 // Parachute
 #include <parachute/algorithm/for_each.hpp>
+#include <parachute/algorithm/reduce.hpp>
+#include <parachute/algorithm/scan.hpp>
+#include <parachute/algorithm/sort.hpp>
 #include <parachute/algorithm/transform.hpp>
+#include <parachute/algorithm/transform_reduce.hpp>
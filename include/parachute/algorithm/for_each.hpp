@@ -6,11 +6,12 @@
 #pragma once
 
 // C++ Standard Library
-#include <algorithm>
+#include <cstddef>
+#include <iterator>
 
 // Parachute
+#include <parachute/algorithm/partitioner.hpp>
 #include <parachute/pool_base.hpp>
-#include <parachute/utility/countdown.hpp>
 
 namespace para::algorithm
 {
@@ -22,22 +23,37 @@ namespace para::algorithm
  * @param first  iterator to first element in sequence
  * @param last  iterator to one past last element in sequence
  * @param f  callback to run on each element of sequence
+ * @param partitioner  decides how the sequence is split into tasks
  *
  * @return f
  */
-template <typename WorkGroupT, typename WorkQueueT, typename WorkControlT, typename InputIt, typename UnaryFunction>
-UnaryFunction
-for_each(pool_base<WorkGroupT, WorkQueueT, WorkControlT>& pool, InputIt first, InputIt last, UnaryFunction f)
+template <
+  typename WorkGroupT,
+  typename WorkQueueT,
+  typename WorkControlT,
+  typename InputIt,
+  typename UnaryFunction,
+  typename PartitionerT = static_partitioner,
+  typename = std::enable_if_t<detail::is_partitioner_v<PartitionerT>>>
+UnaryFunction for_each(
+  pool_base<WorkGroupT, WorkQueueT, WorkControlT>& pool,
+  InputIt first,
+  InputIt last,
+  UnaryFunction f,
+  const PartitionerT& partitioner = PartitionerT{})
 {
-  utility::countdown barrier{ static_cast<std::size_t>(std::distance(first, last)) };
-  std::for_each(first, last, [&pool, &barrier, &f](auto&& value) mutable {
-    pool.emplace([&barrier, &f, &value]() {
-      f(value);
-      --barrier;
-    });
-  });
-  barrier.wait();
+  detail::parallel_for_chunks(
+    pool,
+    partitioner,
+    static_cast<std::size_t>(std::distance(first, last)),
+    [&f](std::size_t count, InputIt chunk_first) {
+      for (; count > 0; --count, ++chunk_first)
+      {
+        f(*chunk_first);
+      }
+    },
+    first);
   return f;
 }
 
-}  // namespace para::algorithm
\ No newline at end of file
+}  // namespace para::algorithm
@@ -0,0 +1,279 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file partitioner.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+// Parachute
+#include <parachute/utility/countdown.hpp>
+
+namespace para::algorithm
+{
+
+/**
+ * @brief Splits a sequence into contiguous chunks of \c grain elements, each run as one task
+ *
+ * A \c grain of zero splits the sequence into one chunk per worker
+ */
+struct static_partitioner
+{
+  std::size_t grain = 0;
+};
+
+/**
+ * @brief Splits a sequence into chunks of \c grain elements, which workers claim one at a time
+ *
+ * For random-access sequences, one task per worker claims chunks from a shared atomic cursor until none are left
+ */
+struct dynamic_partitioner
+{
+  std::size_t grain = 1;
+};
+
+/**
+ * @brief Splits a sequence into chunks which shrink as work is claimed, but never below \c grain elements
+ *
+ * Each chunk holds the remaining element count, divided by twice the worker count
+ */
+struct guided_partitioner
+{
+  std::size_t grain = 1;
+};
+
+namespace detail
+{
+
+/**
+ * @brief Checks if \c T is a partitioner type
+ */
+template <typename T>
+inline constexpr bool is_partitioner_v = std::is_same_v<T, static_partitioner> or
+  std::is_same_v<T, dynamic_partitioner> or std::is_same_v<T, guided_partitioner>;
+
+/**
+ * @brief Checks if all iterators \c IteratorTs are random-access
+ */
+template <typename... IteratorTs>
+inline constexpr bool is_random_access_v =
+  (std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<IteratorTs>::iterator_category> and
+   ...);
+
+/**
+ * @brief Returns size of the next guided chunk, given \c remaining unclaimed elements
+ */
+constexpr std::size_t
+guided_chunk_size(const guided_partitioner& partitioner, const std::size_t remaining, const std::size_t n_workers)
+{
+  return std::min(remaining, std::max(std::max<std::size_t>(partitioner.grain, 1), remaining / (2 * n_workers)));
+}
+
+/**
+ * @brief Returns chunk sizes used to split a sequence of \c n elements, in order
+ */
+template <typename PartitionerT>
+std::vector<std::size_t> chunk_sizes(const PartitionerT& partitioner, const std::size_t n, const std::size_t n_workers)
+{
+  std::vector<std::size_t> sizes;
+  if constexpr (std::is_same_v<PartitionerT, guided_partitioner>)
+  {
+    for (std::size_t remaining = n; remaining > 0;)
+    {
+      sizes.push_back(guided_chunk_size(partitioner, remaining, n_workers));
+      remaining -= sizes.back();
+    }
+  }
+  else
+  {
+    const std::size_t grain = (partitioner.grain > 0) ? partitioner.grain : (n + n_workers - 1) / n_workers;
+    sizes.reserve((n + grain - 1) / grain);
+    for (std::size_t offset = 0; offset < n; offset += grain)
+    {
+      sizes.push_back(std::min(grain, n - offset));
+    }
+  }
+  return sizes;
+}
+
+/**
+ * @brief Claims the next chunk [first, last) of [0, n) from a shared \c cursor
+ *
+ * @return false if no elements are left to claim
+ */
+inline bool claim_chunk(
+  const dynamic_partitioner& partitioner,
+  std::atomic<std::size_t>& cursor,
+  const std::size_t n,
+  [[maybe_unused]] const std::size_t n_workers,
+  std::size_t& first,
+  std::size_t& last)
+{
+  const std::size_t grain = std::max<std::size_t>(partitioner.grain, 1);
+  first = cursor.fetch_add(grain, std::memory_order_relaxed);
+  last = std::min(n, first + grain);
+  return first < n;
+}
+
+/**
+ * @copydoc claim_chunk
+ */
+inline bool claim_chunk(
+  const guided_partitioner& partitioner,
+  std::atomic<std::size_t>& cursor,
+  const std::size_t n,
+  const std::size_t n_workers,
+  std::size_t& first,
+  std::size_t& last)
+{
+  first = cursor.load(std::memory_order_relaxed);
+  do
+  {
+    if (first >= n)
+    {
+      return false;
+    }
+    last = first + guided_chunk_size(partitioner, n - first, n_workers);
+  } while (!cursor.compare_exchange_weak(first, last, std::memory_order_relaxed));
+  return true;
+}
+
+/**
+ * @brief Runs <code>fn(first, last)</code> over index sub-ranges of [0, n) on \c pool, then waits for all of them
+ *
+ * The calling thread runs queued work while it waits (see <code>pool_base::try_run_one</code>), so that parallel
+ * algorithms may be nested inside work running on the same pool, whatever its size
+ */
+template <typename PoolT, typename PartitionerT, typename ChunkFnT>
+void parallel_for_index(PoolT& pool, const PartitionerT& partitioner, const std::size_t n, ChunkFnT& fn)
+{
+  const std::size_t n_workers = std::max<std::size_t>(pool.size(), 1);
+  if constexpr (std::is_same_v<PartitionerT, static_partitioner>)
+  {
+    const std::size_t grain = (partitioner.grain > 0) ? partitioner.grain : (n + n_workers - 1) / n_workers;
+    utility::countdown barrier{ (n + grain - 1) / grain };
+    for (std::size_t first = 0; first < n; first += grain)
+    {
+      pool.emplace([&fn, &barrier, first, last = std::min(n, first + grain)] {
+        fn(first, last);
+        --barrier;
+      });
+    }
+    barrier.wait([&pool] { return pool.try_run_one(); });
+  }
+  else
+  {
+    std::atomic<std::size_t> cursor = 0;
+    const std::size_t grain = std::max<std::size_t>(partitioner.grain, 1);
+    const std::size_t n_tasks = std::min(n_workers, (n + grain - 1) / grain);
+    utility::countdown barrier{ n_tasks };
+    for (std::size_t t = 0; t < n_tasks; ++t)
+    {
+      pool.emplace([&fn, &barrier, &cursor, &partitioner, n, n_workers] {
+        std::size_t first = 0;
+        std::size_t last = 0;
+        while (claim_chunk(partitioner, cursor, n, n_workers, first, last))
+        {
+          fn(first, last);
+        }
+        --barrier;
+      });
+    }
+    barrier.wait([&pool] { return pool.try_run_one(); });
+  }
+}
+
+/**
+ * @brief Runs <code>fn(count, chunk_firsts...)</code> over chunks of sequences starting at \c firsts... on \c pool,
+ *        then waits for all of them
+ *
+ * Random-access sequences are split by index; other sequences are walked once, on the calling thread, to find the
+ * start of each chunk. The calling thread runs queued work while it waits.
+ *
+ * @param pool  thread pool
+ * @param partitioner  decides how sequences are split into chunks
+ * @param n  number of elements to visit in each sequence
+ * @param fn  callback run on each chunk, with its element count and the iterators to its first elements
+ * @param firsts...  iterators to the first element of each sequence
+ */
+template <typename PoolT, typename PartitionerT, typename ChunkFnT, typename... IteratorTs>
+void parallel_for_chunks(
+  PoolT& pool,
+  const PartitionerT& partitioner,
+  const std::size_t n,
+  ChunkFnT&& fn,
+  IteratorTs... firsts)
+{
+  if (n == 0)
+  {
+    return;
+  }
+  else if constexpr (is_random_access_v<IteratorTs...>)
+  {
+    auto index_fn = [&fn, firsts...](const std::size_t first, const std::size_t last) {
+      fn(last - first, std::next(firsts, static_cast<std::ptrdiff_t>(first))...);
+    };
+    parallel_for_index(pool, partitioner, n, index_fn);
+  }
+  else
+  {
+    const auto sizes = chunk_sizes(partitioner, n, std::max<std::size_t>(pool.size(), 1));
+    utility::countdown barrier{ sizes.size() };
+    for (const std::size_t count : sizes)
+    {
+      pool.emplace([&fn, &barrier, count, firsts...] {
+        fn(count, firsts...);
+        --barrier;
+      });
+      (std::advance(firsts, static_cast<std::ptrdiff_t>(count)), ...);
+    }
+    barrier.wait([&pool] { return pool.try_run_one(); });
+  }
+}
+
+/**
+ * @brief Runs <code>fn(chunk_index, chunk_first, chunk_size)</code> over each chunk of a sequence starting at \c first
+ *        on \c pool, then waits for all of them
+ *
+ * Chunk layout, given by \c sizes (see <code>chunk_sizes</code>), is fixed up front; each chunk is therefore identified
+ * by its position in the sequence, regardless of which worker runs it
+ *
+ * @param pool  thread pool
+ * @param sizes  size of each chunk, in sequence order
+ * @param first  iterator to first element in sequence
+ * @param fn  callback run on each chunk
+ */
+template <typename PoolT, typename IteratorT, typename ChunkFnT>
+void parallel_for_each_chunk(PoolT& pool, const std::vector<std::size_t>& sizes, IteratorT first, ChunkFnT&& fn)
+{
+  std::vector<IteratorT> firsts;
+  firsts.reserve(sizes.size());
+  for (const std::size_t count : sizes)
+  {
+    firsts.push_back(first);
+    std::advance(first, static_cast<std::ptrdiff_t>(count));
+  }
+
+  parallel_for_chunks(
+    pool,
+    dynamic_partitioner{ 1 },
+    sizes.size(),
+    [&fn, base = firsts.begin()](std::size_t count, auto chunk_first, auto chunk_size) {
+      for (; count > 0; --count, ++chunk_first, ++chunk_size)
+      {
+        fn(static_cast<std::size_t>(std::distance(base, chunk_first)), *chunk_first, *chunk_size);
+      }
+    },
+    firsts.begin(),
+    sizes.begin());
+}
+
+}  // namespace detail
+}  // namespace para::algorithm
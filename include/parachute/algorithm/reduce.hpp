@@ -0,0 +1,115 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file reduce.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Parachute
+#include <parachute/algorithm/partitioner.hpp>
+#include <parachute/pool_base.hpp>
+
+namespace para::algorithm
+{
+namespace detail
+{
+
+/**
+ * @brief Reduces <code>transform_op(*it)</code> over each element of [first, first + n) with \c reduce_op
+ *
+ * Each chunk is reduced to a partial result in parallel; partial results are then combined pairwise, in chunk order,
+ * as a balanced tree. The combine order therefore depends only on chunk layout.
+ */
+template <typename PoolT, typename InputIt, typename T, typename BinaryOp, typename UnaryOp, typename PartitionerT>
+T reduce_chunks(
+  PoolT& pool,
+  const PartitionerT& partitioner,
+  InputIt first,
+  const std::size_t n,
+  T init,
+  BinaryOp& reduce_op,
+  UnaryOp& transform_op)
+{
+  if (n == 0)
+  {
+    return init;
+  }
+
+  const auto sizes = chunk_sizes(partitioner, n, std::max<std::size_t>(pool.size(), 1));
+  std::vector<std::optional<T>> partials(sizes.size());
+  parallel_for_each_chunk(
+    pool,
+    sizes,
+    first,
+    [&partials, &reduce_op, &transform_op](const std::size_t k, InputIt chunk_first, std::size_t count) {
+      T partial = transform_op(*chunk_first);
+      for (++chunk_first, --count; count > 0; --count, ++chunk_first)
+      {
+        partial = reduce_op(std::move(partial), transform_op(*chunk_first));
+      }
+      partials[k].emplace(std::move(partial));
+    });
+
+  for (std::size_t stride = 1; stride < partials.size(); stride *= 2)
+  {
+    for (std::size_t i = 0; i + stride < partials.size(); i += 2 * stride)
+    {
+      partials[i].emplace(reduce_op(std::move(*partials[i]), std::move(*partials[i + stride])));
+    }
+  }
+  return reduce_op(std::move(init), std::move(*partials.front()));
+}
+
+}  // namespace detail
+
+/**
+ * @brief Parallel version of std::reduce which combines each element of a sequence [first, last) with \c init
+ *
+ * Elements are reduced per chunk in parallel, then chunk results are combined as a balanced tree in sequence order.
+ *
+ * @param pool  thread pool
+ * @param first  iterator to first element in sequence
+ * @param last  iterator to one past last element in sequence
+ * @param init  initial value
+ * @param op  associative binary operation used to combine values
+ * @param partitioner  decides how the sequence is split into chunks
+ *
+ * @return <code>op(init, op(op(*first, ...), ...))</code>
+ *
+ * @note for a deterministic combine order, e.g. so floating point results do not change with worker count, use a
+ *       partitioner with a fixed, non-zero grain (<code>static_partitioner{g}</code> or
+ *       <code>dynamic_partitioner{g}</code>), so chunk layout does not depend on the pool
+ */
+template <
+  typename WorkGroupT,
+  typename WorkQueueT,
+  typename WorkControlT,
+  typename InputIt,
+  typename T,
+  typename BinaryOp = std::plus<>,
+  typename PartitionerT = static_partitioner,
+  typename = std::enable_if_t<detail::is_partitioner_v<PartitionerT>>>
+T reduce(
+  pool_base<WorkGroupT, WorkQueueT, WorkControlT>& pool,
+  InputIt first,
+  const InputIt last,
+  T init,
+  BinaryOp op = BinaryOp{},
+  const PartitionerT& partitioner = PartitionerT{})
+{
+  auto identity = [](auto&& value) -> decltype(auto) { return std::forward<decltype(value)>(value); };
+  return detail::reduce_chunks(
+    pool, partitioner, first, static_cast<std::size_t>(std::distance(first, last)), std::move(init), op, identity);
+}
+
+}  // namespace para::algorithm
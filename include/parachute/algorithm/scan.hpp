@@ -0,0 +1,364 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file scan.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Parachute
+#include <parachute/algorithm/partitioner.hpp>
+#include <parachute/algorithm/transform.hpp>
+#include <parachute/pool_base.hpp>
+
+namespace para::algorithm
+{
+namespace detail
+{
+
+/**
+ * @brief Value type produced by applying \c UnaryOp to elements of \c InputIt
+ */
+template <typename InputIt, typename UnaryOp>
+using scan_value_t = std::decay_t<std::invoke_result_t<UnaryOp&, typename std::iterator_traits<InputIt>::reference>>;
+
+/**
+ * @brief Writes a prefix scan of <code>transform_op(*it)</code>, over each element of [first, first + n), to \c out
+ *
+ * Runs in two passes over a fixed chunk layout (reduce-then-scan):
+ *  1. each chunk, except the last, is reduced to a partial result in parallel
+ *  2. partial results are scanned, in chunk order, on the calling thread, giving the prefix of each chunk
+ *  3. each chunk is scanned in parallel, starting from its prefix
+ *
+ * Only step 2 is serial, and it visits one value per chunk.
+ *
+ * @param init  value combined before the first element, if any; required for exclusive scans
+ * @param inclusive  if true, <code>out[i]</code> includes element \c i; otherwise, it holds the prefix before it
+ *
+ * @return iterator to one past the last element written
+ */
+template <
+  typename PoolT,
+  typename PartitionerT,
+  typename InputIt,
+  typename OutputIt,
+  typename T,
+  typename BinaryOp,
+  typename UnaryOp>
+OutputIt scan_chunks(
+  PoolT& pool,
+  const PartitionerT& partitioner,
+  const InputIt first,
+  const std::size_t n,
+  OutputIt out,
+  std::optional<T> init,
+  BinaryOp& reduce_op,
+  UnaryOp& transform_op,
+  const bool inclusive)
+{
+  static_assert(is_forward_iterator<InputIt>::value, "scan algorithms require forward input iterators");
+  static_assert(is_forward_iterator<OutputIt>::value, "scan algorithms require forward output iterators");
+
+  if (n == 0)
+  {
+    return out;
+  }
+
+  const auto sizes = chunk_sizes(partitioner, n, std::max<std::size_t>(pool.size(), 1));
+
+  std::vector<OutputIt> out_firsts;
+  out_firsts.reserve(sizes.size());
+  for (const std::size_t count : sizes)
+  {
+    out_firsts.push_back(out);
+    std::advance(out, static_cast<std::ptrdiff_t>(count));
+  }
+
+  // Reduce all chunks but the last; its total is not part of any prefix
+  const std::vector<std::size_t> reduced_sizes(sizes.begin(), std::prev(sizes.end()));
+  std::vector<std::optional<T>> prefixes(sizes.size());
+  parallel_for_each_chunk(
+    pool,
+    reduced_sizes,
+    first,
+    [&prefixes, &reduce_op, &transform_op](const std::size_t k, InputIt chunk_first, std::size_t count) {
+      T partial = transform_op(*chunk_first);
+      for (++chunk_first, --count; count > 0; --count, ++chunk_first)
+      {
+        partial = reduce_op(std::move(partial), transform_op(*chunk_first));
+      }
+      prefixes[k + 1].emplace(std::move(partial));
+    });
+
+  // Turn chunk totals into chunk prefixes
+  prefixes.front() = std::move(init);
+  for (std::size_t k = 1; k < prefixes.size(); ++k)
+  {
+    if (prefixes[k - 1].has_value())
+    {
+      prefixes[k].emplace(reduce_op(*prefixes[k - 1], std::move(*prefixes[k])));
+    }
+  }
+
+  parallel_for_each_chunk(
+    pool,
+    sizes,
+    first,
+    [&prefixes, &out_firsts, &reduce_op, &transform_op, inclusive](
+      const std::size_t k, InputIt chunk_first, std::size_t count) {
+      auto chunk_out = out_firsts[k];
+      std::optional<T> running = std::move(prefixes[k]);
+      for (; count > 0; --count, ++chunk_first, ++chunk_out)
+      {
+        // Element is read before its output is written, so scans may run in place
+        T next = running.has_value() ? T(reduce_op(*running, transform_op(*chunk_first)))
+                                     : T(transform_op(*chunk_first));
+        if (inclusive)
+        {
+          *chunk_out = next;
+        }
+        else
+        {
+          *chunk_out = std::move(*running);
+        }
+        running.emplace(std::move(next));
+      }
+    });
+
+  return out;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Parallel version of std::inclusive_scan which writes each prefix of a sequence [first, last), including the
+ *        element at the same position, to a sequence starting at \c d_first
+ *
+ * @param pool  thread pool
+ * @param first  iterator to first element in sequence
+ * @param last  iterator to one past last element in sequence
+ * @param d_first  iterator to first element of output sequence; may be \c first
+ * @param op  associative binary operation used to combine values
+ * @param partitioner  decides how the sequence is split into chunks
+ *
+ * @return iterator to one past the last element written
+ *
+ * @note each element is read twice, so \c first and \c d_first must be forward iterators
+ */
+template <
+  typename WorkGroupT,
+  typename WorkQueueT,
+  typename WorkControlT,
+  typename InputIt,
+  typename OutputIt,
+  typename BinaryOp = std::plus<>,
+  typename PartitionerT = static_partitioner,
+  typename = std::enable_if_t<detail::is_partitioner_v<PartitionerT>>>
+OutputIt inclusive_scan(
+  pool_base<WorkGroupT, WorkQueueT, WorkControlT>& pool,
+  const InputIt first,
+  const InputIt last,
+  const OutputIt d_first,
+  BinaryOp op = BinaryOp{},
+  const PartitionerT& partitioner = PartitionerT{})
+{
+  auto identity = [](const auto& value) { return value; };
+  using value_type = detail::scan_value_t<InputIt, decltype(identity)>;
+  return detail::scan_chunks(
+    pool,
+    partitioner,
+    first,
+    static_cast<std::size_t>(std::distance(first, last)),
+    d_first,
+    std::optional<value_type>{},
+    op,
+    identity,
+    true);
+}
+
+/**
+ * @brief Parallel version of std::inclusive_scan which writes each prefix of a sequence [first, last), including the
+ *        element at the same position and starting from \c init, to a sequence starting at \c d_first
+ *
+ * @copydetails inclusive_scan
+ *
+ * @param init  initial value
+ */
+template <
+  typename WorkGroupT,
+  typename WorkQueueT,
+  typename WorkControlT,
+  typename InputIt,
+  typename OutputIt,
+  typename BinaryOp,
+  typename T,
+  typename PartitionerT = static_partitioner,
+  typename = std::enable_if_t<!detail::is_partitioner_v<T> and detail::is_partitioner_v<PartitionerT>>>
+OutputIt inclusive_scan(
+  pool_base<WorkGroupT, WorkQueueT, WorkControlT>& pool,
+  const InputIt first,
+  const InputIt last,
+  const OutputIt d_first,
+  BinaryOp op,
+  T init,
+  const PartitionerT& partitioner = PartitionerT{})
+{
+  auto identity = [](const auto& value) { return value; };
+  return detail::scan_chunks(
+    pool,
+    partitioner,
+    first,
+    static_cast<std::size_t>(std::distance(first, last)),
+    d_first,
+    std::optional<T>{ std::move(init) },
+    op,
+    identity,
+    true);
+}
+
+/**
+ * @brief Parallel version of std::exclusive_scan which writes each prefix of a sequence [first, last), excluding the
+ *        element at the same position and starting from \c init, to a sequence starting at \c d_first
+ *
+ * @param pool  thread pool
+ * @param first  iterator to first element in sequence
+ * @param last  iterator to one past last element in sequence
+ * @param d_first  iterator to first element of output sequence; may be \c first
+ * @param init  initial value; written to \c d_first
+ * @param op  associative binary operation used to combine values
+ * @param partitioner  decides how the sequence is split into chunks
+ *
+ * @return iterator to one past the last element written
+ *
+ * @note each element is read twice, so \c first and \c d_first must be forward iterators
+ */
+template <
+  typename WorkGroupT,
+  typename WorkQueueT,
+  typename WorkControlT,
+  typename InputIt,
+  typename OutputIt,
+  typename T,
+  typename BinaryOp = std::plus<>,
+  typename PartitionerT = static_partitioner,
+  typename = std::enable_if_t<detail::is_partitioner_v<PartitionerT>>>
+OutputIt exclusive_scan(
+  pool_base<WorkGroupT, WorkQueueT, WorkControlT>& pool,
+  const InputIt first,
+  const InputIt last,
+  const OutputIt d_first,
+  T init,
+  BinaryOp op = BinaryOp{},
+  const PartitionerT& partitioner = PartitionerT{})
+{
+  auto identity = [](const auto& value) { return value; };
+  return detail::scan_chunks(
+    pool,
+    partitioner,
+    first,
+    static_cast<std::size_t>(std::distance(first, last)),
+    d_first,
+    std::optional<T>{ std::move(init) },
+    op,
+    identity,
+    false);
+}
+
+/**
+ * @brief Parallel version of std::transform_inclusive_scan which writes each prefix of
+ *        <code>transform_op(*it)</code>, over a sequence [first, last), to a sequence starting at \c d_first
+ *
+ * @param pool  thread pool
+ * @param first  iterator to first element in sequence
+ * @param last  iterator to one past last element in sequence
+ * @param d_first  iterator to first element of output sequence; may be \c first
+ * @param reduce_op  associative binary operation used to combine values
+ * @param transform_op  unary operation applied to each element before it is combined; called twice per element
+ * @param partitioner  decides how the sequence is split into chunks
+ *
+ * @return iterator to one past the last element written
+ */
+template <
+  typename WorkGroupT,
+  typename WorkQueueT,
+  typename WorkControlT,
+  typename InputIt,
+  typename OutputIt,
+  typename BinaryOp,
+  typename UnaryOp,
+  typename PartitionerT = static_partitioner,
+  typename = std::enable_if_t<detail::is_partitioner_v<PartitionerT>>>
+OutputIt transform_inclusive_scan(
+  pool_base<WorkGroupT, WorkQueueT, WorkControlT>& pool,
+  const InputIt first,
+  const InputIt last,
+  const OutputIt d_first,
+  BinaryOp reduce_op,
+  UnaryOp transform_op,
+  const PartitionerT& partitioner = PartitionerT{})
+{
+  using value_type = detail::scan_value_t<InputIt, UnaryOp>;
+  return detail::scan_chunks(
+    pool,
+    partitioner,
+    first,
+    static_cast<std::size_t>(std::distance(first, last)),
+    d_first,
+    std::optional<value_type>{},
+    reduce_op,
+    transform_op,
+    true);
+}
+
+/**
+ * @brief Parallel version of std::transform_inclusive_scan which writes each prefix of
+ *        <code>transform_op(*it)</code>, over a sequence [first, last) and starting from \c init, to a sequence
+ *        starting at \c d_first
+ *
+ * @copydetails transform_inclusive_scan
+ *
+ * @param init  initial value
+ */
+template <
+  typename WorkGroupT,
+  typename WorkQueueT,
+  typename WorkControlT,
+  typename InputIt,
+  typename OutputIt,
+  typename BinaryOp,
+  typename UnaryOp,
+  typename T,
+  typename PartitionerT = static_partitioner,
+  typename = std::enable_if_t<!detail::is_partitioner_v<T> and detail::is_partitioner_v<PartitionerT>>>
+OutputIt transform_inclusive_scan(
+  pool_base<WorkGroupT, WorkQueueT, WorkControlT>& pool,
+  const InputIt first,
+  const InputIt last,
+  const OutputIt d_first,
+  BinaryOp reduce_op,
+  UnaryOp transform_op,
+  T init,
+  const PartitionerT& partitioner = PartitionerT{})
+{
+  return detail::scan_chunks(
+    pool,
+    partitioner,
+    first,
+    static_cast<std::size_t>(std::distance(first, last)),
+    d_first,
+    std::optional<T>{ std::move(init) },
+    reduce_op,
+    transform_op,
+    true);
+}
+
+}  // namespace para::algorithm
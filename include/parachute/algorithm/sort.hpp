@@ -0,0 +1,295 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file sort.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+// Parachute
+#include <parachute/algorithm/partitioner.hpp>
+#include <parachute/pool_base.hpp>
+
+namespace para::algorithm
+{
+namespace detail
+{
+
+/**
+ * @brief Sequences with at most this many elements are sorted on the calling thread
+ */
+inline constexpr std::size_t sort_sequential_cutoff = 1UL << 13;
+
+/**
+ * @brief Returns number of elements from \c a among the first \c k elements of a stable merge of \c a and \c b
+ *
+ * @see "Merge Path - Parallel Merging Made Simple", Odeh et al., IPDPS 2012
+ */
+template <typename RandomIt, typename CompareT>
+std::size_t merge_path_split(
+  const RandomIt a,
+  const std::size_t na,
+  const RandomIt b,
+  const std::size_t nb,
+  const std::size_t k,
+  CompareT& comp)
+{
+  std::size_t lo = (k > nb) ? (k - nb) : 0;
+  std::size_t hi = std::min(k, na);
+  while (lo < hi)
+  {
+    const std::size_t mid = lo + (hi - lo) / 2;
+    // a[mid] is merged before b[k - mid - 1], so more than mid elements come from a
+    if (!comp(b[k - mid - 1], a[mid]))
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+/**
+ * @brief A piece of one merge round; merges src[a_first, a_last) and src[b_first, b_last) into dst[out_first, ...)
+ */
+struct merge_piece
+{
+  std::size_t a_first;
+  std::size_t a_last;
+  std::size_t b_first;
+  std::size_t b_last;
+  std::size_t out_first;
+};
+
+/**
+ * @brief Uninitialized scratch storage for \c n elements, used as a merge target
+ */
+template <typename T> class sort_buffer
+{
+public:
+  explicit sort_buffer(const std::size_t n) : data_{ allocator_.allocate(n) }, size_{ n } {}
+
+  sort_buffer(const sort_buffer&) = delete;
+
+  ~sort_buffer()
+  {
+    if (constructed_)
+    {
+      std::destroy_n(data_, size_);
+    }
+    allocator_.deallocate(data_, size_);
+  }
+
+  T* data() { return data_; }
+
+  /// Marks all elements as constructed, to be destroyed with the buffer
+  void set_constructed() { constructed_ = true; }
+
+private:
+  /// Allocates element storage
+  std::allocator<T> allocator_;
+  /// Element storage
+  T* data_;
+  /// Number of elements
+  std::size_t size_;
+  /// True once every element has been constructed
+  bool constructed_ = false;
+};
+
+/**
+ * @brief Parallel merge sort of [first, first + n)
+ *
+ * The sequence is split into about one run per worker (never fewer than \c sort_sequential_cutoff elements each).
+ * Runs are sorted in parallel with \c sort_run, then adjacent runs are merged in rounds, ping-ponging between the
+ * sequence and a scratch buffer. Each merge is further split along its merge path, so every round keeps all workers
+ * busy, including the last one, which merges only two runs.
+ */
+template <typename PoolT, typename RandomIt, typename CompareT, typename SortRunT>
+void merge_sort(PoolT& pool, const RandomIt first, const std::size_t n, CompareT& comp, SortRunT sort_run)
+{
+  using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+  const std::size_t n_workers = std::max<std::size_t>(pool.size(), 1);
+  if (n_workers == 1 or n <= sort_sequential_cutoff)
+  {
+    sort_run(first, first + static_cast<std::ptrdiff_t>(n), comp);
+    return;
+  }
+
+  const std::size_t n_runs = std::min(n_workers, (n + sort_sequential_cutoff - 1) / sort_sequential_cutoff);
+  const std::size_t run_size = (n + n_runs - 1) / n_runs;
+  const std::size_t piece_size = std::max(sort_sequential_cutoff, (n + n_workers - 1) / n_workers);
+
+  std::vector<std::size_t> bounds;
+  for (std::size_t offset = 0; offset < n; offset += run_size)
+  {
+    bounds.push_back(offset);
+  }
+  bounds.push_back(n);
+
+  // Sort each run, and move it into scratch storage, which is merged from during the first round
+  sort_buffer<value_type> buffer{ n };
+  auto sort_fn = [&](const std::size_t r_first, const std::size_t r_last) {
+    for (std::size_t r = r_first; r < r_last; ++r)
+    {
+      const auto run_first = first + static_cast<std::ptrdiff_t>(bounds[r]);
+      const auto run_last = first + static_cast<std::ptrdiff_t>(bounds[r + 1]);
+      sort_run(run_first, run_last, comp);
+      std::uninitialized_move(run_first, run_last, buffer.data() + bounds[r]);
+    }
+  };
+  parallel_for_index(pool, dynamic_partitioner{ 1 }, bounds.size() - 1, sort_fn);
+  buffer.set_constructed();
+
+  // Merge adjacent runs until one is left; sources alternate between the buffer and the sequence
+  bool src_is_buffer = true;
+  std::vector<merge_piece> pieces;
+  while (bounds.size() > 2)
+  {
+    pieces.clear();
+    std::vector<std::size_t> next_bounds;
+    for (std::size_t r = 0; r + 1 < bounds.size(); r += 2)
+    {
+      next_bounds.push_back(bounds[r]);
+      if (r + 2 == bounds.size())
+      {
+        // Odd run out; carried into the next round as is
+        pieces.push_back({ bounds[r], bounds[r + 1], bounds[r + 1], bounds[r + 1], bounds[r] });
+        continue;
+      }
+
+      const std::size_t a = bounds[r];
+      const std::size_t b = bounds[r + 1];
+      const std::size_t na = b - a;
+      const std::size_t nb = bounds[r + 2] - b;
+      std::size_t i_prev = 0;
+      for (std::size_t k = piece_size; k < na + nb + piece_size; k += piece_size)
+      {
+        const std::size_t k_piece = std::min(k, na + nb);
+        const std::size_t k_prev = k - piece_size;
+        const std::size_t i = src_is_buffer
+          ? merge_path_split(buffer.data() + a, na, buffer.data() + b, nb, k_piece, comp)
+          : merge_path_split(first + static_cast<std::ptrdiff_t>(a), na, first + static_cast<std::ptrdiff_t>(b), nb,
+                             k_piece, comp);
+        pieces.push_back({ a + i_prev, a + i, b + (k_prev - i_prev), b + (k_piece - i), a + k_prev });
+        i_prev = i;
+      }
+    }
+    next_bounds.push_back(n);
+
+    auto merge_fn = [&](const std::size_t p_first, const std::size_t p_last) {
+      const auto merge_into = [&comp](auto src, auto dst, const merge_piece& p) {
+        std::merge(
+          std::make_move_iterator(src + static_cast<std::ptrdiff_t>(p.a_first)),
+          std::make_move_iterator(src + static_cast<std::ptrdiff_t>(p.a_last)),
+          std::make_move_iterator(src + static_cast<std::ptrdiff_t>(p.b_first)),
+          std::make_move_iterator(src + static_cast<std::ptrdiff_t>(p.b_last)),
+          dst + static_cast<std::ptrdiff_t>(p.out_first),
+          comp);
+      };
+      for (std::size_t p = p_first; p < p_last; ++p)
+      {
+        if (src_is_buffer)
+        {
+          merge_into(buffer.data(), first, pieces[p]);
+        }
+        else
+        {
+          merge_into(first, buffer.data(), pieces[p]);
+        }
+      }
+    };
+    parallel_for_index(pool, dynamic_partitioner{ 1 }, pieces.size(), merge_fn);
+
+    bounds = std::move(next_bounds);
+    src_is_buffer = !src_is_buffer;
+  }
+
+  // Sorted result was last written to the buffer; move it back into the sequence
+  if (src_is_buffer)
+  {
+    auto move_fn = [&](const std::size_t i_first, const std::size_t i_last) {
+      std::move(buffer.data() + i_first, buffer.data() + i_last, first + static_cast<std::ptrdiff_t>(i_first));
+    };
+    parallel_for_index(pool, static_partitioner{}, n, move_fn);
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Parallel version of std::sort which sorts a sequence [first, last) in place
+ *
+ * Runs of the sequence are sorted in parallel with std::sort, then merged in parallel. Sequences which are short, or
+ * which are sorted on a single worker, are sorted with std::sort on the calling thread.
+ *
+ * @param pool  thread pool
+ * @param first  iterator to first element in sequence
+ * @param last  iterator to one past last element in sequence
+ * @param comp  strict weak ordering of elements
+ *
+ * @note uses scratch storage for a copy of the sequence
+ */
+template <
+  typename WorkGroupT,
+  typename WorkQueueT,
+  typename WorkControlT,
+  typename RandomIt,
+  typename CompareT = std::less<>>
+void sort(
+  pool_base<WorkGroupT, WorkQueueT, WorkControlT>& pool,
+  const RandomIt first,
+  const RandomIt last,
+  CompareT comp = CompareT{})
+{
+  static_assert(detail::is_random_access_v<RandomIt>, "algorithm::sort requires random-access iterators");
+  detail::merge_sort(
+    pool, first, static_cast<std::size_t>(std::distance(first, last)), comp, [](auto run_first, auto run_last, auto& c) {
+      std::sort(run_first, run_last, c);
+    });
+}
+
+/**
+ * @brief Parallel version of std::stable_sort which sorts a sequence [first, last) in place, keeping the relative
+ *        order of equivalent elements
+ *
+ * Runs of the sequence are sorted in parallel with std::stable_sort, then merged in parallel; merges take equivalent
+ * elements from the earlier run first.
+ *
+ * @param pool  thread pool
+ * @param first  iterator to first element in sequence
+ * @param last  iterator to one past last element in sequence
+ * @param comp  strict weak ordering of elements
+ *
+ * @note uses scratch storage for a copy of the sequence
+ */
+template <
+  typename WorkGroupT,
+  typename WorkQueueT,
+  typename WorkControlT,
+  typename RandomIt,
+  typename CompareT = std::less<>>
+void stable_sort(
+  pool_base<WorkGroupT, WorkQueueT, WorkControlT>& pool,
+  const RandomIt first,
+  const RandomIt last,
+  CompareT comp = CompareT{})
+{
+  static_assert(detail::is_random_access_v<RandomIt>, "algorithm::stable_sort requires random-access iterators");
+  detail::merge_sort(
+    pool, first, static_cast<std::size_t>(std::distance(first, last)), comp, [](auto run_first, auto run_last, auto& c) {
+      std::stable_sort(run_first, run_last, c);
+    });
+}
+
+}  // namespace para::algorithm
@@ -7,28 +7,96 @@
 
 // C++ Standard Library
 #include <algorithm>
-#include <mutex>
-#include <thread>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
 
 // Parachute
+#include <parachute/algorithm/partitioner.hpp>
 #include <parachute/pool_base.hpp>
-#include <parachute/utility/countdown.hpp>
 
 namespace para::algorithm
 {
 
+namespace detail
+{
+
+/**
+ * @brief Checks if \c IteratorT is a multi-pass (forward) iterator
+ */
+template <typename IteratorT, typename = void> struct is_forward_iterator : std::false_type
+{};
+
+template <typename IteratorT>
+struct is_forward_iterator<IteratorT, std::void_t<typename std::iterator_traits<IteratorT>::iterator_category>>
+    : std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<IteratorT>::iterator_category>
+{};
+
+/**
+ * @brief Checks if \c OutputIt is a <code>std::back_insert_iterator</code> to a container which can be resized to
+ *        hold \c ValueT elements before they are assigned
+ */
+template <typename OutputIt, typename ValueT, typename = void> struct is_resizable_back_inserter : std::false_type
+{};
+
+template <typename ContainerT, typename ValueT>
+struct is_resizable_back_inserter<
+  std::back_insert_iterator<ContainerT>,
+  ValueT,
+  std::void_t<decltype(std::declval<ContainerT&>().resize(std::size_t{}))>>
+    : std::bool_constant<
+        std::is_default_constructible_v<typename ContainerT::value_type> and
+        std::is_assignable_v<typename ContainerT::value_type&, ValueT>>
+{};
+
+/**
+ * @brief Returns container which a <code>std::back_insert_iterator</code> appends to
+ */
+template <typename ContainerT> ContainerT& container_of(const std::back_insert_iterator<ContainerT>& out)
+{
+  /// Exposes protected <code>std::back_insert_iterator::container</code> member
+  struct accessor : std::back_insert_iterator<ContainerT>
+  {
+    explicit accessor(const std::back_insert_iterator<ContainerT>& other) : std::back_insert_iterator<ContainerT>{ other }
+    {}
+    ContainerT& get() const { return *this->container; }
+  };
+  return accessor{ out }.get();
+}
+
+/**
+ * @brief Returns a chunk callback which assigns <code>f(*in)</code> to each <code>*out</code> in a chunk
+ */
+template <typename UnaryFunction> auto transform_chunk(UnaryFunction& f)
+{
+  return [&f](std::size_t count, auto chunk_in, auto chunk_out) {
+    for (; count > 0; --count, ++chunk_in, ++chunk_out)
+    {
+      *chunk_out = f(*chunk_in);
+    }
+  };
+}
+
+}  // namespace detail
+
 /**
  * @brief Parallel version of std::transform which invokes a unary callback on each element of a sequence [first, last)
  *
+ * Output values are written in the same order as the input sequence:
+ * - forward (multi-pass) output iterators are written to in place, in parallel
+ * - <code>std::back_insert_iterator</code> outputs to resizable containers have their container grown by the input
+ *   size up front; values are then written in place, in parallel
+ * - all other output iterators are written to once all chunks are done, from per-chunk buffers, in order
+ *
  * @param pool  thread pool
  * @param first  iterator to first element in sequence
  * @param last  iterator to one past last element in sequence
  * @param out  output iterator; dereferenced value is assigned to return value of <code>f(*first)</code>
  * @param f  callback to run on each element of sequence which returns an output value to assign to <code>out</code>
+ * @param partitioner  decides how the sequence is split into tasks
  *
- * @return f
- *
- * @warning order of output values is not gauranteed to match input sequence
+ * @return output iterator one past the last value written
  */
 template <
   typename WorkGroupT,
@@ -36,23 +104,57 @@ template <
   typename WorkControlT,
   typename InputIt,
   typename OutputIt,
-  typename UnaryFunction>
+  typename UnaryFunction,
+  typename PartitionerT = static_partitioner,
+  typename = std::enable_if_t<detail::is_partitioner_v<PartitionerT>>>
 OutputIt transform(
   pool_base<WorkGroupT, WorkQueueT, WorkControlT>& pool,
   InputIt first,
   const InputIt last,
   OutputIt out,
-  UnaryFunction f)
+  UnaryFunction f,
+  const PartitionerT& partitioner = PartitionerT{})
 {
-  utility::countdown barrier{ static_cast<std::size_t>(std::distance(first, last)) };
-  std::for_each(first, last, [&pool, &barrier, &out, &f](auto&& value) mutable {
-    pool.emplace([&barrier, &out, &f, &value]() mutable {
-      auto t_value = f(value);
-      barrier.decrement([&out, &f, t_value = std::move(t_value)]() mutable { (*out++) = std::move(t_value); });
-    });
-  });
-  barrier.wait();
-  return out;
+  using value_type =
+    std::decay_t<std::invoke_result_t<UnaryFunction&, typename std::iterator_traits<InputIt>::reference>>;
+
+  const auto n = static_cast<std::size_t>(std::distance(first, last));
+
+  if constexpr (detail::is_forward_iterator<OutputIt>::value)
+  {
+    detail::parallel_for_chunks(pool, partitioner, n, detail::transform_chunk(f), first, out);
+    return std::next(out, static_cast<std::ptrdiff_t>(n));
+  }
+  else if constexpr (detail::is_resizable_back_inserter<OutputIt, value_type>::value)
+  {
+    auto& container = detail::container_of(out);
+    const auto offset = static_cast<std::ptrdiff_t>(container.size());
+    container.resize(container.size() + n);
+    detail::parallel_for_chunks(
+      pool, partitioner, n, detail::transform_chunk(f), first, std::next(container.begin(), offset));
+    return out;
+  }
+  else
+  {
+    // Buffer each chunk separately, then stitch them back in order
+    const auto chunk_sizes = detail::chunk_sizes(partitioner, n, std::max<std::size_t>(pool.size(), 1));
+    std::vector<std::vector<value_type>> chunk_values(chunk_sizes.size());
+    detail::parallel_for_each_chunk(
+      pool, chunk_sizes, first, [&f, &chunk_values](const std::size_t k, InputIt chunk_first, std::size_t count) {
+        auto& values = chunk_values[k];
+        values.reserve(count);
+        for (; count > 0; --count, ++chunk_first)
+        {
+          values.push_back(f(*chunk_first));
+        }
+      });
+
+    for (auto& values : chunk_values)
+    {
+      out = std::move(values.begin(), values.end(), out);
+    }
+    return out;
+  }
 }
 
 /**
@@ -63,6 +165,7 @@ OutputIt transform(
  * @param in_last  iterator to one past last element in sequence
  * @param out  output iterator; dereferenced value is assigned to return value of <code>f(*first)</code>
  * @param f  callback to run on each element of sequence which returns an output value to assign to <code>out</code>
+ * @param partitioner  decides how the sequence is split into tasks
  *
  * @return f
  */
@@ -72,29 +175,23 @@ template <
   typename WorkControlT,
   typename InputIt,
   typename OutputIt,
-  typename UnaryFunction>
+  typename UnaryFunction,
+  typename PartitionerT = static_partitioner,
+  typename = std::enable_if_t<detail::is_partitioner_v<PartitionerT>>>
 OutputIt transform(
   pool_base<WorkGroupT, WorkQueueT, WorkControlT>& pool,
   InputIt in_first,
   const InputIt in_last,
   OutputIt out_first,
   const OutputIt out_last,
-  UnaryFunction f)
+  UnaryFunction f,
+  const PartitionerT& partitioner = PartitionerT{})
 {
   const auto n = std::min(
     static_cast<std::size_t>(std::distance(in_first, in_last)),
     static_cast<std::size_t>(std::distance(out_first, out_last)));
-  utility::countdown barrier{ n };
-  std::for_each(in_first, std::next(in_first, n), [&pool, &barrier, &out_first, &f](auto&& value) mutable {
-    auto& out = *out_first;
-    pool.emplace([&barrier, &out, &f, &value]() mutable {
-      out = f(value);
-      --barrier;
-    });
-    ++out_first;
-  });
-  barrier.wait();
-  return out_first;
+  detail::parallel_for_chunks(pool, partitioner, n, detail::transform_chunk(f), in_first, out_first);
+  return std::next(out_first, static_cast<std::ptrdiff_t>(n));
 }
 
-}  // namespace para::algorithm
\ No newline at end of file
+}  // namespace para::algorithm
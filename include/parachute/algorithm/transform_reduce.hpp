@@ -0,0 +1,70 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file transform_reduce.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// Parachute
+#include <parachute/algorithm/partitioner.hpp>
+#include <parachute/algorithm/reduce.hpp>
+#include <parachute/pool_base.hpp>
+
+namespace para::algorithm
+{
+
+/**
+ * @brief Parallel version of std::transform_reduce which combines <code>transform_op(*it)</code>, for each element of a
+ *        sequence [first, last), with \c init
+ *
+ * Transformed elements are reduced per chunk in parallel, then chunk results are combined as a balanced tree in
+ * sequence order.
+ *
+ * @param pool  thread pool
+ * @param first  iterator to first element in sequence
+ * @param last  iterator to one past last element in sequence
+ * @param init  initial value
+ * @param reduce_op  associative binary operation used to combine values
+ * @param transform_op  unary operation applied to each element before it is combined
+ * @param partitioner  decides how the sequence is split into chunks
+ *
+ * @return <code>reduce_op(init, reduce_op(transform_op(*first), ...))</code>
+ *
+ * @note see <code>reduce</code> for how to get a deterministic combine order
+ */
+template <
+  typename WorkGroupT,
+  typename WorkQueueT,
+  typename WorkControlT,
+  typename InputIt,
+  typename T,
+  typename BinaryOp,
+  typename UnaryOp,
+  typename PartitionerT = static_partitioner,
+  typename = std::enable_if_t<detail::is_partitioner_v<PartitionerT>>>
+T transform_reduce(
+  pool_base<WorkGroupT, WorkQueueT, WorkControlT>& pool,
+  InputIt first,
+  const InputIt last,
+  T init,
+  BinaryOp reduce_op,
+  UnaryOp transform_op,
+  const PartitionerT& partitioner = PartitionerT{})
+{
+  return detail::reduce_chunks(
+    pool,
+    partitioner,
+    first,
+    static_cast<std::size_t>(std::distance(first, last)),
+    std::move(init),
+    reduce_op,
+    transform_op);
+}
+
+}  // namespace para::algorithm
@@ -0,0 +1,365 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file coroutine.hpp
+ */
+#pragma once
+
+#if defined(__cpp_impl_coroutine)
+
+// C++ Standard Library
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// Parachute
+#include <parachute/non_blocking_future.hpp>
+
+namespace para
+{
+
+/**
+ * @brief Awaiter which resumes a coroutine on a worker of \c PoolT
+ *
+ * @see schedule_on
+ */
+template <typename PoolT> class pool_awaiter
+{
+public:
+  explicit pool_awaiter(PoolT& pool) : pool_{ std::addressof(pool) } {}
+
+  constexpr bool await_ready() const noexcept { return false; }
+
+  void await_suspend(std::coroutine_handle<> handle) { pool_->emplace([handle] { handle.resume(); }); }
+
+  constexpr void await_resume() const noexcept {}
+
+private:
+  /// Pool which resumes the awaiting coroutine
+  PoolT* pool_;
+};
+
+/**
+ * @brief Returns an awaiter which suspends the awaiting coroutine, then resumes it on a worker of \c pool
+ *
+ * @code{.cpp}
+ * co_await para::schedule_on(pool);
+ * // ... runs on a worker of pool
+ * @endcode
+ *
+ * @note a coroutine whose resumption is still queued when \c pool is destroyed without running it (e.g. a pool with
+ *       <code>work_control_default</code>) is never resumed, and its frame is not freed
+ */
+template <typename PoolT> [[nodiscard]] pool_awaiter<PoolT> schedule_on(PoolT& pool)
+{
+  return pool_awaiter<PoolT>{ pool };
+}
+
+/**
+ * @brief Awaiter which suspends a coroutine until a <code>non_blocking_future</code> holds a result
+ *
+ * The coroutine is resumed by the future's continuation, on the thread which sets the result; nothing polls or blocks
+ * in the meantime
+ */
+template <typename T> class future_awaiter
+{
+public:
+  explicit future_awaiter(non_blocking_future<T>&& future) : future_{ std::move(future) } {}
+
+  bool await_ready() const { return future_->valid(); }
+
+  void await_suspend(std::coroutine_handle<> handle)
+  {
+    // Nothing may touch this awaiter after registering, since the coroutine may already be resumed
+    detail::on_ready(std::move(*future_), [this, handle](non_blocking_future<T>&& ready) {
+      future_.emplace(std::move(ready));
+      handle.resume();
+    });
+  }
+
+  decltype(auto) await_resume() { return future_->get(); }
+
+private:
+  /// Future being waited on; replaced by the ready future handed back through its continuation
+  std::optional<non_blocking_future<T>> future_;
+};
+
+/**
+ * @brief Suspends the awaiting coroutine until \c future holds a result, then returns it (or throws its exception)
+ */
+template <typename T> [[nodiscard]] future_awaiter<T> operator co_await(non_blocking_future<T>&& future)
+{
+  return future_awaiter<T>{ std::move(future) };
+}
+
+namespace coro
+{
+
+template <typename T> class task;
+
+namespace detail
+{
+
+/**
+ * @brief Promise state common to all <code>coro::task</code> types
+ *
+ * Tasks start suspended; on completion, control transfers directly to the awaiting coroutine, if there is one
+ */
+class task_promise_base
+{
+public:
+  /**
+   * @brief Resumes the awaiting coroutine, if any, once a task completes
+   */
+  struct final_awaiter
+  {
+    constexpr bool await_ready() const noexcept { return false; }
+
+    template <typename PromiseT>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseT> handle) const noexcept
+    {
+      if (auto continuation = handle.promise().continuation_; continuation)
+      {
+        return continuation;
+      }
+      return std::noop_coroutine();
+    }
+
+    constexpr void await_resume() const noexcept {}
+  };
+
+  constexpr std::suspend_always initial_suspend() const noexcept { return {}; }
+
+  constexpr final_awaiter final_suspend() const noexcept { return {}; }
+
+  void unhandled_exception() { exception_ = std::current_exception(); }
+
+  /**
+   * @brief Sets coroutine to resume once this task completes
+   */
+  void set_continuation(const std::coroutine_handle<> continuation) { continuation_ = continuation; }
+
+protected:
+  /// Rethrows exception which escaped the task, if any
+  void rethrow_if_failed()
+  {
+    if (exception_)
+    {
+      std::rethrow_exception(std::exchange(exception_, nullptr));
+    }
+  }
+
+private:
+  /// Coroutine awaiting this task
+  std::coroutine_handle<> continuation_;
+  /// Exception which escaped the task
+  std::exception_ptr exception_;
+};
+
+/**
+ * @brief Promise type of <code>coro::task<T></code>
+ */
+template <typename T> class task_promise : public task_promise_base
+{
+public:
+  task<T> get_return_object();
+
+  template <typename U, typename = std::enable_if_t<std::is_convertible_v<U&&, T>>> void return_value(U&& value)
+  {
+    value_.emplace(std::forward<U>(value));
+  }
+
+  /**
+   * @brief Returns result of the task
+   * @throws exception which escaped the task
+   */
+  T result()
+  {
+    rethrow_if_failed();
+    return std::move(*value_);
+  }
+
+private:
+  /// Value returned by the task
+  std::optional<T> value_;
+};
+
+/**
+ * @copydoc task_promise
+ * @note void specialization
+ */
+template <> class task_promise<void> : public task_promise_base
+{
+public:
+  task<void> get_return_object();
+
+  constexpr void return_void() const noexcept {}
+
+  /**
+   * @brief Rethrows exception which escaped the task, if any
+   */
+  void result() { rethrow_if_failed(); }
+};
+
+/**
+ * @brief Coroutine which starts immediately and frees its own frame when it finishes
+ */
+struct detached
+{
+  struct promise_type
+  {
+    constexpr detached get_return_object() const noexcept { return {}; }
+    constexpr std::suspend_never initial_suspend() const noexcept { return {}; }
+    constexpr std::suspend_never final_suspend() const noexcept { return {}; }
+    constexpr void return_void() const noexcept {}
+    void unhandled_exception() const noexcept { std::terminate(); }
+  };
+};
+
+}  // namespace detail
+
+/**
+ * @brief Coroutine return type for asynchronous work which produces a \c T
+ *
+ * A task is lazy: it starts when it is awaited (<code>co_await std::move(t)</code>), or when passed to
+ * <code>coro::start</code>. When it finishes, the awaiting coroutine is resumed directly, on the same thread, without
+ * growing the stack. Exceptions which escape the task are rethrown to the awaiter.
+ *
+ * @code{.cpp}
+ * coro::task<int> answer(pool& wp)
+ * {
+ *   co_await schedule_on(wp);
+ *   co_return 42;
+ * }
+ * @endcode
+ *
+ * @tparam T  result type
+ */
+template <typename T = void> class [[nodiscard]] task
+{
+public:
+  using promise_type = detail::task_promise<T>;
+
+  task(const task&) = delete;
+
+  task(task&& other) noexcept : handle_{ std::exchange(other.handle_, nullptr) } {}
+
+  task& operator=(task&& other) noexcept
+  {
+    if (this != &other)
+    {
+      reset();
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Destroys coroutine frame
+   */
+  ~task() { reset(); }
+
+  /**
+   * @brief Returns true if this task holds a coroutine which has finished
+   */
+  bool done() const { return handle_ and handle_.done(); }
+
+  /**
+   * @brief Starts this task, and suspends the awaiting coroutine until it finishes
+   *
+   * @return task result
+   * @throws exception which escaped the task
+   */
+  auto operator co_await() && noexcept
+  {
+    struct awaiter
+    {
+      std::coroutine_handle<promise_type> handle;
+
+      bool await_ready() const noexcept { return handle.done(); }
+
+      std::coroutine_handle<> await_suspend(const std::coroutine_handle<> awaiting) noexcept
+      {
+        handle.promise().set_continuation(awaiting);
+        return handle;
+      }
+
+      T await_resume() { return handle.promise().result(); }
+    };
+    return awaiter{ handle_ };
+  }
+
+private:
+  friend class detail::task_promise<T>;
+
+  explicit task(const std::coroutine_handle<promise_type> handle) : handle_{ handle } {}
+
+  /// Destroys coroutine frame, if any
+  void reset()
+  {
+    if (handle_)
+    {
+      std::exchange(handle_, nullptr).destroy();
+    }
+  }
+
+  /// Coroutine which runs this task
+  std::coroutine_handle<promise_type> handle_;
+};
+
+template <typename T> task<T> detail::task_promise<T>::get_return_object()
+{
+  return task<T>{ std::coroutine_handle<task_promise>::from_promise(*this) };
+}
+
+inline task<void> detail::task_promise<void>::get_return_object()
+{
+  return task<void>{ std::coroutine_handle<task_promise>::from_promise(*this) };
+}
+
+namespace detail
+{
+
+/// Runs \c t to completion, then sets its result (or exception) on \c promise
+template <typename T> detached run_to_promise(task<T> t, non_blocking_promise<T> promise)
+{
+  try
+  {
+    if constexpr (std::is_void_v<T>)
+    {
+      co_await std::move(t);
+      promise.set_value();
+    }
+    else
+    {
+      promise.set_value(co_await std::move(t));
+    }
+  }
+  catch (...)
+  {
+    promise.set_exception(std::current_exception());
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Starts \c t on the calling thread, and returns a future for its result
+ *
+ * \c t runs until its first suspension before this returns. The returned future may be waited on, chained with
+ * <code>then</code>, or awaited from another coroutine.
+ */
+template <typename T> [[nodiscard]] non_blocking_future<T> start(task<T> t)
+{
+  non_blocking_promise<T> promise;
+  auto future = promise.get_future();
+  detail::run_to_promise(std::move(t), std::move(promise));
+  return future;
+}
+
+}  // namespace coro
+}  // namespace para
+
+#endif  // defined(__cpp_impl_coroutine)
@@ -0,0 +1,102 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file idle_policy.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+
+// Parachute
+#include <parachute/utility/cpu_relax.hpp>
+
+namespace para
+{
+
+/**
+ * @brief Idle policy under which a worker parks (blocks on a condition variable) as soon as it runs out of work
+ *
+ * Costs no CPU time while idle, but each wake-up costs a syscall on both the submitting and the woken thread
+ */
+struct idle_park
+{
+  /// Number of polls while spinning, before yielding
+  static constexpr std::size_t spin_count = 0;
+  /// Number of polls while yielding, before parking
+  static constexpr std::size_t yield_count = 0;
+};
+
+/**
+ * @brief Idle policy under which a worker which runs out of work spins, then yields, then parks
+ *
+ * Work which arrives while a worker is still spinning or yielding is picked up without a wake-up syscall; bursty
+ * workloads thus trade some idle CPU time for lower submit-to-start latency.
+ *
+ * @tparam SpinV  number of polls for work, each followed by a CPU relax hint (<code>pause</code> on x86)
+ * @tparam YieldV  number of polls for work, each followed by <code>std::this_thread::yield()</code>
+ */
+template <std::size_t SpinV = 4096, std::size_t YieldV = 64> struct idle_spin
+{
+  /// Number of polls while spinning, before yielding
+  static constexpr std::size_t spin_count = SpinV;
+  /// Number of polls while yielding, before parking
+  static constexpr std::size_t yield_count = YieldV;
+};
+
+namespace detail
+{
+
+/**
+ * @brief Idle policy of a work control type; <code>WorkControlT::idle_policy</code>, if declared, else
+ *        <code>idle_park</code>
+ */
+template <typename WorkControlT, typename = void> struct idle_policy_of
+{
+  using type = idle_park;
+};
+
+template <typename WorkControlT>
+struct idle_policy_of<WorkControlT, std::void_t<typename WorkControlT::idle_policy>>
+{
+  using type = typename WorkControlT::idle_policy;
+};
+
+template <typename WorkControlT> using idle_policy_of_t = typename idle_policy_of<WorkControlT>::type;
+
+/**
+ * @brief Returns true if \c IdlePolicyT polls for work before parking
+ */
+template <typename IdlePolicyT>
+inline constexpr bool idle_polls_v = (IdlePolicyT::spin_count + IdlePolicyT::yield_count) > 0;
+
+/**
+ * @brief Calls \c poll until it returns true, or until \c IdlePolicyT has no polls left
+ *
+ * @return true if \c poll returned true
+ */
+template <typename IdlePolicyT, typename PollFnT> bool idle_poll(PollFnT&& poll)
+{
+  for (std::size_t i = 0; i < IdlePolicyT::spin_count; ++i)
+  {
+    if (poll())
+    {
+      return true;
+    }
+    utility::cpu_relax();
+  }
+  for (std::size_t i = 0; i < IdlePolicyT::yield_count; ++i)
+  {
+    if (poll())
+    {
+      return true;
+    }
+    std::this_thread::yield();
+  }
+  return poll();
+}
+
+}  // namespace detail
+}  // namespace para
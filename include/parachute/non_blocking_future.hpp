@@ -7,12 +7,17 @@
 
 // C++ Standard Library
 #include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
-#include <mutex>
 #include <type_traits>
+#include <utility>
 
 // Parachute
+#include <parachute/task.hpp>
+#include <parachute/utility/atomic_wait.hpp>
+#include <parachute/utility/slab.hpp>
 #include <parachute/utility/uninitialized.hpp>
 
 namespace para
@@ -26,7 +31,8 @@ template <typename T> class non_blocking_future;
 enum class non_blocking_future_errc
 {
   no_state,  ///< state was already retrieved from future; or future already retrieved from promise
-  promise_already_satisfied  ///< value already set to promise
+  promise_already_satisfied,  ///< value already set to promise
+  broken_promise  ///< promise was destroyed before a value or exception was set
 };
 
 /**
@@ -40,108 +46,371 @@ struct non_blocking_future_error
 namespace detail
 {
 
+template <typename T, typename FnT> void on_ready(non_blocking_future<T>&& future, FnT&& fn);
+
 /**
- * @brief Holds result state shared between threads
+ * @brief States of a <code>non_blocking_shared_state</code>
  *
- * @tparam T  held value type
+ * Moves from \c empty to \c value or \c exception (through \c setting) when the promise is satisfied, then to
+ * \c retrieved when the future takes the result
  */
-template <typename T> class non_blocking_shared_state;
+enum class non_blocking_state : std::uint32_t
+{
+  empty,  ///< no result set
+  setting,  ///< result is being written by the promise
+  value,  ///< value (or ready signal, for void) is set
+  exception,  ///< exception is set
+  retrieved  ///< result was taken by the future
+};
 
 /**
- * @copydoc non_blocking_shared_state
- * @note void specialization; meant for flagging only
+ * @brief Result state machine, wait support and reference count common to all shared states
+ *
+ * The result is published by a release store of the state, and observed by an acquire load, so no lock is taken to
+ * set, poll or get a result. Waiters spin briefly, then park on the state word.
  */
-template <> class non_blocking_shared_state<void>
+class non_blocking_shared_state_common
 {
 public:
   /**
-   * @brief Returns true if result is ready such that <code>non_blocking_promise::get()</code> is valid
+   * @brief Returns true if result is ready such that <code>non_blocking_future::get()</code> is valid
    */
-  bool valid() const { return result_ready_flag_; }
+  bool valid() const
+  {
+    const auto s = state();
+    return s == non_blocking_state::value or s == non_blocking_state::exception;
+  }
+
+  /**
+   * @brief Blocks until a result is set
+   */
+  void wait() const
+  {
+    waiters_.fetch_add(1, std::memory_order_seq_cst);
+    for (auto s = state(); pending(s); s = state())
+    {
+      utility::atomic_wait(state_, static_cast<std::uint32_t>(s));
+    }
+    waiters_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Blocks until a result is set, calling \c help while it waits
+   *
+   * \c help returns true if it did some work, after which the state is checked again; otherwise, waits for a result,
+   * for at most \c help_interval, before calling \c help again
+   */
+  template <typename HelpFnT> void wait(HelpFnT&& help) const
+  {
+    while (pending(state()))
+    {
+      if (!help())
+      {
+        wait_until(std::chrono::steady_clock::now() + help_interval);
+      }
+    }
+  }
+
+  /// Longest time <code>wait(help)</code> blocks between calls to \c help
+  static constexpr std::chrono::microseconds help_interval{ 100 };
+
+  /**
+   * @brief Blocks until a result is set, or until \c deadline passes
+   *
+   * @return true if result is set
+   */
+  template <typename ClockT, typename DurationT>
+  bool wait_until(const std::chrono::time_point<ClockT, DurationT>& deadline) const
+  {
+    waiters_.fetch_add(1, std::memory_order_seq_cst);
+    bool done = true;
+    for (auto s = state(); done and pending(s); s = state())
+    {
+      done = utility::atomic_wait_until(state_, static_cast<std::uint32_t>(s), deadline);
+    }
+    waiters_.fetch_sub(1, std::memory_order_relaxed);
+    return !pending(state());
+  }
 
   /**
    * @brief Sets current exception
    */
-  void set(std::exception_ptr&& ex) { current_exception_ = std::move(ex); }
+  void set(std::exception_ptr&& ex)
+  {
+    begin_set();
+    current_exception_ = std::move(ex);
+    finish_set(non_blocking_state::exception);
+  }
 
   /**
-   * @brief Sets ready state
+   * @brief Sets a <code>broken_promise</code> error, if no result was set
    */
-  void set()
+  void abandon()
   {
-    if (result_ready_flag_)
+    if (try_begin_set())
     {
-      throw non_blocking_future_error{ non_blocking_future_errc::promise_already_satisfied };
+      const non_blocking_future_error error{ non_blocking_future_errc::broken_promise };
+      current_exception_ = std::make_exception_ptr(error);
+      finish_set(non_blocking_state::exception);
     }
-    result_ready_flag_ = true;
   }
 
   /**
-   * @brief Clears ready state
-   * @throws if there is an active exception
+   * @brief Registers \c continuation to run once, right after a result is set
+   *
+   * Runs \c continuation on the calling thread if a result is already set; otherwise, it runs on the thread which sets
+   * the result. Only one continuation may be registered.
    */
-  void get()
+  void set_continuation(task&& continuation)
   {
-    if (current_exception_ != nullptr)
+    continuation_ = std::move(continuation);
+    if (continuation_state_.exchange(continuation_registered, std::memory_order_acq_rel) == continuation_fired)
     {
-      std::rethrow_exception(current_exception_);
+      run_continuation();
     }
+  }
+
+  /**
+   * @brief Adds a reference to this state
+   */
+  void acquire() { references_.fetch_add(1, std::memory_order_relaxed); }
+
+protected:
+  non_blocking_shared_state_common() = default;
+
+  /// Returns current state
+  non_blocking_state state() const { return static_cast<non_blocking_state>(state_.load(std::memory_order_acquire)); }
 
-    if (!result_ready_flag_)
+  /// Returns true if no result has been published in state \c s
+  static constexpr bool pending(const non_blocking_state s)
+  {
+    return s == non_blocking_state::empty or s == non_blocking_state::setting;
+  }
+
+  /// Claims the right to write a result; returns false if a result was already set
+  bool try_begin_set()
+  {
+    auto expected = static_cast<std::uint32_t>(non_blocking_state::empty);
+    return state_.compare_exchange_strong(
+      expected,
+      static_cast<std::uint32_t>(non_blocking_state::setting),
+      std::memory_order_acquire,
+      std::memory_order_relaxed);
+  }
+
+  /// Claims the right to write a result
+  void begin_set()
+  {
+    if (!try_begin_set())
     {
+      throw non_blocking_future_error{ non_blocking_future_errc::promise_already_satisfied };
+    }
+  }
+
+  /// Gives up the right to write a result, if writing it failed
+  void abort_set() { state_.store(static_cast<std::uint32_t>(non_blocking_state::empty), std::memory_order_relaxed); }
+
+  /// Publishes a result which was written after <code>begin_set</code>, then wakes any waiters and runs continuation
+  void finish_set(const non_blocking_state s)
+  {
+    state_.store(static_cast<std::uint32_t>(s), std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_seq_cst) > 0)
+    {
+      utility::atomic_notify_all(state_);
+    }
+    // Registering thread and this thread both swap continuation state; whichever swaps second runs it
+    if (continuation_state_.exchange(continuation_fired, std::memory_order_acq_rel) == continuation_registered)
+    {
+      run_continuation();
+    }
+  }
+
+  /**
+   * @brief Marks result as retrieved
+   *
+   * @throws held exception, if one was set
+   * @throws non_blocking_future_error if no result is ready
+   */
+  void retrieve()
+  {
+    switch (state())
+    {
+    case non_blocking_state::value:
+      state_.store(static_cast<std::uint32_t>(non_blocking_state::retrieved), std::memory_order_relaxed);
+      return;
+    case non_blocking_state::exception:
+      state_.store(static_cast<std::uint32_t>(non_blocking_state::retrieved), std::memory_order_relaxed);
+      std::rethrow_exception(std::exchange(current_exception_, nullptr));
+    default:
       throw non_blocking_future_error{ non_blocking_future_errc::no_state };
     }
-    result_ready_flag_ = false;
   }
 
+  /// Removes a reference to this state; returns true if it was the last one
+  bool drop() { return references_.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+
 private:
-  /// Indicates if result is ready or not
-  std::atomic<bool> result_ready_flag_ = false;
+  /// <code>continuation_state_</code> value before a continuation is registered, or a result is set
+  static constexpr std::uint32_t continuation_none = 0;
+  /// <code>continuation_state_</code> value once a continuation is registered
+  static constexpr std::uint32_t continuation_registered = 1;
+  /// <code>continuation_state_</code> value once a result is set
+  static constexpr std::uint32_t continuation_fired = 2;
+
+  /// Runs registered continuation
+  void run_continuation()
+  {
+    // Moved out first, since the continuation may release the last reference to this state
+    task continuation{ std::move(continuation_) };
+    continuation();
+  }
+
+  /// Current <code>non_blocking_state</code>
+  utility::atomic_wait_word state_ = static_cast<std::uint32_t>(non_blocking_state::empty);
+  /// Number of threads blocked in <code>wait</code> or <code>wait_until</code>
+  mutable std::atomic<std::uint32_t> waiters_ = 0;
+  /// Number of promises and futures referring to this state
+  std::atomic<std::uint32_t> references_ = 1;
   /// Current exception
   std::exception_ptr current_exception_ = nullptr;
+  /// Tracks whether continuation or result came first
+  std::atomic<std::uint32_t> continuation_state_ = continuation_none;
+  /// Work to run once a result is set
+  task continuation_;
 };
 
+/**
+ * @brief Holds result state shared between threads
+ *
+ * @tparam T  held value type
+ */
+template <typename T> class non_blocking_shared_state;
+
 /**
  * @copydoc non_blocking_shared_state
+ * @note void specialization; meant for flagging only
  */
-template <typename T> class non_blocking_shared_state
+template <> class non_blocking_shared_state<void> : public non_blocking_shared_state_common
 {
 public:
+  using non_blocking_shared_state_common::set;
+
   /**
-   * @brief Returns true if result is ready such that <code>non_blocking_promise::get()</code> is valid
+   * @brief Sets ready state
    */
-  bool valid() { return result_signal_.valid(); }
+  void set()
+  {
+    begin_set();
+    finish_set(non_blocking_state::value);
+  }
 
   /**
-   * @brief Sets current exception
+   * @brief Clears ready state
+   * @throws if there is an active exception
+   */
+  void get() { retrieve(); }
+
+  /**
+   * @brief Removes a reference to this state; destroys it if it was the last one
+   */
+  void release()
+  {
+    if (drop())
+    {
+      delete this;
+    }
+  }
+
+  /**
+   * @brief Allocates shared state from a thread-local slab
    */
-  void set(std::exception_ptr&& ex) { result_signal_.set(std::move(ex)); }
+  static void* operator new(std::size_t)
+  {
+    return utility::slab<sizeof(non_blocking_shared_state), alignof(non_blocking_shared_state)>::allocate();
+  }
+
+  /**
+   * @brief Returns shared state storage to a thread-local slab
+   */
+  static void operator delete(void* const ptr) noexcept
+  {
+    utility::slab<sizeof(non_blocking_shared_state), alignof(non_blocking_shared_state)>::deallocate(ptr);
+  }
+};
+
+/**
+ * @copydoc non_blocking_shared_state
+ */
+template <typename T> class non_blocking_shared_state : public non_blocking_shared_state_common
+{
+public:
+  using non_blocking_shared_state_common::set;
 
   /**
    * @brief Sets value
    */
   void set(T&& result) noexcept(false)
   {
-    std::lock_guard lock{ result_mutex_ };
-    result_value_.emplace(std::move(result));
-    result_signal_.set();
+    begin_set();
+    try
+    {
+      result_value_.emplace(std::move(result));
+    }
+    catch (...)
+    {
+      abort_set();
+      throw;
+    }
+    finish_set(non_blocking_state::value);
   }
 
   /**
-   * @brief Returns held value if valid, or null
+   * @brief Returns held value
+   * @throws if there is an active exception, or if no value is ready
    */
   T get()
   {
-    std::lock_guard lock{ result_mutex_ };
-    result_signal_.get();
+    retrieve();
     return result_value_.get();
   }
 
+  /**
+   * @brief Removes a reference to this state; destroys it if it was the last one
+   */
+  void release()
+  {
+    if (drop())
+    {
+      delete this;
+    }
+  }
+
+  /**
+   * @brief Allocates shared state from a thread-local slab
+   */
+  static void* operator new(std::size_t)
+  {
+    return utility::slab<sizeof(non_blocking_shared_state), alignof(non_blocking_shared_state)>::allocate();
+  }
+
+  /**
+   * @brief Returns shared state storage to a thread-local slab
+   */
+  static void operator delete(void* const ptr) noexcept
+  {
+    utility::slab<sizeof(non_blocking_shared_state), alignof(non_blocking_shared_state)>::deallocate(ptr);
+  }
+
+  ~non_blocking_shared_state()
+  {
+    if (state() == non_blocking_state::value)
+    {
+      // Value was set, but never retrieved
+      result_value_.get();
+    }
+  }
+
 private:
-  /// Indicates if result is ready or not
-  non_blocking_shared_state<void> result_signal_;
-  /// Protects shared result state between threads of execution
-  std::mutex result_mutex_;
   /// Held result value
   utility::uninitialized<T> result_value_;
 };
@@ -157,7 +426,7 @@ public:
   /**
    * @brief Creates a non_blocking_promise_common with unfulfilled result value
    */
-  non_blocking_promise_common() : state_{ new detail::non_blocking_shared_state<T>{} }, owning_{ true } {}
+  non_blocking_promise_common() : state_{ new detail::non_blocking_shared_state<T>{} }, future_retrieved_{ false } {}
 
   /**
    * @brief Returns handle to shared work state
@@ -171,27 +440,89 @@ public:
 
   non_blocking_promise_common(const non_blocking_promise_common&) = delete;
 
-  non_blocking_promise_common(non_blocking_promise_common&& other) : state_{ other.state_ }, owning_{ other.owning_ }
+  non_blocking_promise_common(non_blocking_promise_common&& other) noexcept :
+      state_{ other.state_ }, future_retrieved_{ other.future_retrieved_ }
   {
     other.state_ = nullptr;
-    other.owning_ = false;
+    other.future_retrieved_ = false;
   }
 
+  /**
+   * @brief Releases shared state; a future still waiting on it is given a <code>broken_promise</code> error
+   */
   ~non_blocking_promise_common()
   {
-    if (owning_)
+    if (state_ == nullptr)
+    {
+      return;
+    }
+    else if (future_retrieved_)
     {
-      delete state_;
+      state_->abandon();
     }
+    state_->release();
   }
 
 protected:
   /// Shared result state
   detail::non_blocking_shared_state<T>* state_ = nullptr;
-  /// Shared state is owned by promise
-  bool owning_ = false;
+  /// Future was already retrieved from promise
+  bool future_retrieved_ = false;
+};
+
+/**
+ * @brief Result type of a continuation \c FnT run on a value of type \c T
+ */
+template <typename T, typename FnT> struct continuation_result
+{
+  using type = std::invoke_result_t<FnT&, T>;
+};
+
+/**
+ * @copydoc continuation_result
+ */
+template <typename FnT> struct continuation_result<void, FnT>
+{
+  using type = std::invoke_result_t<FnT&>;
 };
 
+/**
+ * @brief Passes the result held by \c state through \c fn, and sets the outcome on \c promise
+ *
+ * An exception held by \c state, or thrown by \c fn, is set on \c promise instead
+ */
+template <typename T, typename ResultT, typename FnT>
+void invoke_continuation(non_blocking_shared_state<T>& state, non_blocking_promise<ResultT>& promise, FnT& fn)
+{
+  try
+  {
+    if constexpr (std::is_void_v<T> and std::is_void_v<ResultT>)
+    {
+      state.get();
+      fn();
+      promise.set_value();
+    }
+    else if constexpr (std::is_void_v<T>)
+    {
+      state.get();
+      promise.set_value(fn());
+    }
+    else if constexpr (std::is_void_v<ResultT>)
+    {
+      fn(state.get());
+      promise.set_value();
+    }
+    else
+    {
+      promise.set_value(fn(state.get()));
+    }
+  }
+  catch (...)
+  {
+    promise.set_exception(std::current_exception());
+  }
+}
+
 }  // namespace detail
 
 /**
@@ -203,11 +534,15 @@ template <typename T> class non_blocking_future
 {
   friend class detail::non_blocking_promise_common<T>;
 
+  template <typename U, typename FnT> friend void detail::on_ready(non_blocking_future<U>&& future, FnT&& fn);
+
 public:
   /**
    * @brief Returns true if value held by future is valid
+   *
+   * @note single atomic load; does not block
    */
-  bool valid() { return state_->valid(); }
+  bool valid() const { return state_->valid(); }
 
   /**
    * @brief Returns held value if valid, or error
@@ -216,15 +551,81 @@ public:
    */
   decltype(auto) get() { return state_->get(); }
 
+  /**
+   * @brief Blocks until held value is valid
+   */
+  void wait() const { state_->wait(); }
+
+  /**
+   * @brief Blocks until held value is valid, calling \c help while it waits
+   *
+   * Waiting on work from a pool with <code>wait([&pool] { return pool.try_run_one(); })</code> runs queued work on the
+   * calling thread in the meantime, so a worker which waits on work from its own pool does not deadlock it
+   *
+   * @param help  returns true if it did some work; otherwise, the calling thread blocks briefly before calling it again
+   */
+  template <typename HelpFnT> void wait(HelpFnT&& help) const { state_->wait(std::forward<HelpFnT>(help)); }
+
+  /**
+   * @brief Blocks until held value is valid, or until \c timeout elapses
+   *
+   * @return true if held value is valid
+   */
+  template <typename RepT, typename PeriodT> bool wait_for(const std::chrono::duration<RepT, PeriodT>& timeout) const
+  {
+    return state_->wait_until(std::chrono::steady_clock::now() + timeout);
+  }
+
+  /**
+   * @brief Blocks until held value is valid, or until \c deadline passes
+   *
+   * @return true if held value is valid
+   */
+  template <typename ClockT, typename DurationT>
+  bool wait_until(const std::chrono::time_point<ClockT, DurationT>& deadline) const
+  {
+    return state_->wait_until(deadline);
+  }
+
+  /**
+   * @brief Enqueues <code>fn(get())</code> (or <code>fn()</code>, for void) on \c pool once held value is valid
+   *
+   * Nothing blocks while the held value is pending; \c fn is enqueued by the thread which sets the value, or by the
+   * calling thread, if the value is already set. If an exception is held, or thrown by \c fn, it is passed to the
+   * returned future instead. This future is left without shared state, and must not be used afterwards.
+   *
+   * @param pool  pool (e.g. <code>pool_base</code>) which runs \c fn; must outlive the continuation
+   * @param fn  continuation
+   *
+   * @return future for the result of \c fn
+   */
+  template <typename PoolT, typename FnT> [[nodiscard]] auto then(PoolT& pool, FnT&& fn)
+  {
+    return chain([&pool](auto&& step) { pool.emplace(std::forward<decltype(step)>(step)); }, std::forward<FnT>(fn));
+  }
+
+  /**
+   * @brief Runs <code>fn(get())</code> (or <code>fn()</code>, for void) inline once held value is valid
+   *
+   * \c fn runs on the thread which sets the value, or on the calling thread, if the value is already set; it should
+   * therefore be short. Exceptions are passed along as with <code>then(pool, fn)</code>.
+   *
+   * @return future for the result of \c fn
+   */
+  template <typename FnT> [[nodiscard]] auto then(FnT&& fn)
+  {
+    return chain([](auto&& step) { step(); }, std::forward<FnT>(fn));
+  }
+
   non_blocking_future(const non_blocking_future&) = delete;
 
-  non_blocking_future(non_blocking_future&& other) : state_{ other.state_ } { other.state_ = nullptr; }
+  non_blocking_future(non_blocking_future&& other) noexcept : state_{ other.state_ } { other.state_ = nullptr; }
 
   ~non_blocking_future()
   {
     if (state_ != nullptr)
     {
-      delete state_;
+      state_->release();
     }
   }
 
@@ -236,6 +637,31 @@ private:
    */
   explicit non_blocking_future(detail::non_blocking_shared_state<T>* shared_state) : state_{ shared_state } {};
 
+  /**
+   * @brief Registers a continuation which hands <code>fn(get())</code> to \c schedule once held value is valid
+   *
+   */
+  template <typename ScheduleT, typename FnT> auto chain(ScheduleT schedule, FnT&& fn)
+  {
+    using result_type = typename detail::continuation_result<T, std::decay_t<FnT>>::type;
+
+    non_blocking_promise<result_type> promise;
+    auto future = promise.get_future();
+
+    // Continuation takes over the reference held by this future, and releases it once it has run (or is dropped)
+    auto* const state = std::exchange(state_, nullptr);
+    state->set_continuation(
+      [schedule,
+       self = non_blocking_future{ state },
+       promise = std::move(promise),
+       fn = std::forward<FnT>(fn)]() mutable {
+        schedule([self = std::move(self), promise = std::move(promise), fn = std::move(fn)]() mutable {
+          detail::invoke_continuation(*self.state_, promise, fn);
+        });
+      });
+    return future;
+  }
+
   /// Shared result state
   detail::non_blocking_shared_state<T>* state_;
 };
@@ -267,15 +693,29 @@ public:
   void set_value() { this->state_->set(); }
 };
 
+/**
+ * @brief Runs <code>fn(std::move(future))</code> inline once \c future holds a result
+ *
+ * \c fn runs on the thread which sets the result, or on the calling thread, if the result is already set. It is
+ * passed a future whose result is ready, and which it may <code>get()</code> without blocking.
+ */
+template <typename T, typename FnT> void detail::on_ready(non_blocking_future<T>&& future, FnT&& fn)
+{
+  auto* const state = std::exchange(future.state_, nullptr);
+  state->set_continuation([self = non_blocking_future<T>{ state }, fn = std::forward<FnT>(fn)]() mutable {
+    fn(std::move(self));
+  });
+}
+
 template <typename T> non_blocking_future<T> detail::non_blocking_promise_common<T>::get_future() noexcept(false)
 {
-  if (!owning_)
+  if (future_retrieved_)
   {
     throw non_blocking_future_error{ non_blocking_future_errc::no_state };
   }
-  auto* const transferred_state = state_;
-  owning_ = false;
-  return non_blocking_future<T>{ transferred_state };
+  future_retrieved_ = true;
+  state_->acquire();
+  return non_blocking_future<T>{ state_ };
 }
 
-}  // namespace para
\ No newline at end of file
+}  // namespace para
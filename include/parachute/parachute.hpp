@@ -9,6 +9,10 @@
 #include <future>
 
 // Parachute
+#include <parachute/coroutine.hpp>
 #include <parachute/non_blocking_future.hpp>
 #include <parachute/pool.hpp>
 #include <parachute/post.hpp>
+#include <parachute/task_graph.hpp>
+#include <parachute/timer.hpp>
+#include <parachute/when.hpp>
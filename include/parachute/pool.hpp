@@ -8,9 +8,14 @@
 // Parachute
 #include <parachute/pool_base.hpp>
 #include <parachute/work_group/dynamic.hpp>
+#include <parachute/work_group/elastic.hpp>
+#include <parachute/work_group/pinned.hpp>
 #include <parachute/work_group/static.hpp>
 #include <parachute/work_queue/fifo.hpp>
 #include <parachute/work_queue/lifo.hpp>
+#include <parachute/work_queue/priority.hpp>
+#include <parachute/work_queue/ring.hpp>
+#include <parachute/work_queue/stealing.hpp>
 
 namespace para
 {
@@ -41,6 +46,39 @@ private:
   bool working_ = true;
 };
 
+/**
+ * @brief Work pool execution options \c WorkControlT, with workers which idle according to \c IdlePolicyT
+ *
+ * @tparam IdlePolicyT  idle policy, e.g. <code>idle_spin</code> or <code>idle_park</code>
+ * @tparam WorkControlT  work pool execution options to extend
+ */
+template <typename IdlePolicyT, typename WorkControlT = work_control_default> struct work_control_idle : WorkControlT
+{
+  using idle_policy = IdlePolicyT;
+};
+
+/**
+ * @brief Work pool execution options \c WorkControlT, with workers which keep statistics (see
+ *        <code>stats_per_worker</code> and <code>pool_base::stats()</code>)
+ *
+ * @tparam WorkControlT  work pool execution options to extend
+ */
+template <typename WorkControlT = work_control_default> struct work_control_stats : WorkControlT
+{
+  using stats_policy = stats_per_worker;
+};
+
+/**
+ * @brief Work pool execution options \c WorkControlT, with workers which record trace events (see
+ *        <code>trace_events</code> and <code>dump_trace</code>)
+ *
+ * @tparam WorkControlT  work pool execution options to extend
+ */
+template <typename WorkControlT = work_control_default> struct work_control_trace : WorkControlT
+{
+  using trace_policy = trace_events;
+};
+
 /**
  * @brief A single-threaded work
  */
@@ -75,11 +113,125 @@ using pool = pool_base<work_group_dynamic, work_queue_lifo<>, work_control_defau
  */
 using pool_strict = pool_base<work_group_dynamic, work_queue_lifo<>, work_control_strict>;
 
+/**
+ * @brief A multi-threaded worker; thread count decided at runtime
+ *
+ * Each worker keeps a local deque of work and steals from other workers when it runs out. Work enqueued from within a
+ * worker is added to that worker's deque.
+ */
+using pool_stealing = pool_base<work_group_dynamic, work_queue_stealing<>, work_control_default>;
+
+/**
+ * @copydoc pool_stealing
+ * @note always finishes all work
+ */
+using pool_stealing_strict = pool_base<work_group_dynamic, work_queue_stealing<>, work_control_strict>;
+
+/**
+ * @brief A multi-threaded worker; thread count decided at runtime
+ *
+ * Work is run by priority level (see <code>work_queue_priority</code>); work enqueued without a priority runs at the
+ * least urgent level.
+ */
+using pool_priority = pool_base<work_group_dynamic, work_queue_priority<>, work_control_default>;
+
+/**
+ * @copydoc pool_priority
+ * @note always finishes all work
+ */
+using pool_priority_strict = pool_base<work_group_dynamic, work_queue_priority<>, work_control_strict>;
+
+/**
+ * @brief A multi-threaded worker; thread count decided at runtime
+ *
+ * Each worker is pinned to its own CPU (see <code>work_group_pinned</code>), and may query it with
+ * <code>this_worker::cpu()</code>
+ */
+using pool_pinned = pool_base<work_group_pinned, work_queue_lifo<>, work_control_default>;
+
+/**
+ * @copydoc pool_pinned
+ * @note always finishes all work
+ */
+using pool_pinned_strict = pool_base<work_group_pinned, work_queue_lifo<>, work_control_strict>;
+
+/**
+ * @brief A multi-threaded worker; thread count decided at runtime
+ *
+ * Idle workers spin, then yield, before parking (see <code>idle_spin</code>), so that bursts of work start without
+ * waiting on a wake-up
+ */
+using pool_spinning = pool_base<work_group_dynamic, work_queue_lifo<>, work_control_idle<idle_spin<>>>;
+
+/**
+ * @copydoc pool_spinning
+ * @note always finishes all work
+ */
+using pool_spinning_strict =
+  pool_base<work_group_dynamic, work_queue_lifo<>, work_control_idle<idle_spin<>, work_control_strict>>;
+
+/**
+ * @brief A multi-threaded worker; thread count varies at runtime, between a minimum and maximum
+ *
+ * Workers are added while work backs up, and retire after idling (see <code>work_group_elastic</code>)
+ */
+using pool_elastic = pool_base<work_group_elastic, work_queue_lifo<>, work_control_default>;
+
+/**
+ * @copydoc pool_elastic
+ * @note always finishes all work
+ */
+using pool_elastic_strict = pool_base<work_group_elastic, work_queue_lifo<>, work_control_strict>;
+
+/**
+ * @brief A multi-threaded worker; thread count decided at runtime
+ *
+ * Workers keep statistics, read with <code>stats()</code>
+ */
+using pool_instrumented = pool_base<work_group_dynamic, work_queue_lifo<>, work_control_stats<>>;
+
+/**
+ * @copydoc pool_instrumented
+ * @note always finishes all work
+ */
+using pool_instrumented_strict =
+  pool_base<work_group_dynamic, work_queue_lifo<>, work_control_stats<work_control_strict>>;
+
+/**
+ * @brief A multi-threaded worker; thread count decided at runtime
+ *
+ * Records trace events, written out with <code>dump_trace</code>
+ */
+using pool_traced = pool_base<work_group_dynamic, work_queue_lifo<>, work_control_trace<>>;
+
+/**
+ * @copydoc pool_traced
+ * @note always finishes all work
+ */
+using pool_traced_strict = pool_base<work_group_dynamic, work_queue_lifo<>, work_control_trace<work_control_strict>>;
+
 #ifdef PARACHUTE_COMPILED
 extern template class pool_base<work_group_static<1>, work_queue_lifo<>, work_control_default>;
 extern template class pool_base<work_group_static<1>, work_queue_lifo<>, work_control_strict>;
 extern template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_default>;
 extern template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_strict>;
+extern template class pool_base<work_group_dynamic, work_queue_stealing<>, work_control_default>;
+extern template class pool_base<work_group_dynamic, work_queue_stealing<>, work_control_strict>;
+extern template class pool_base<work_group_dynamic, work_queue_priority<>, work_control_default>;
+extern template class pool_base<work_group_dynamic, work_queue_priority<>, work_control_strict>;
+extern template class pool_base<work_group_pinned, work_queue_lifo<>, work_control_default>;
+extern template class pool_base<work_group_pinned, work_queue_lifo<>, work_control_strict>;
+extern template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_idle<idle_spin<>>>;
+extern template class pool_base<
+  work_group_dynamic,
+  work_queue_lifo<>,
+  work_control_idle<idle_spin<>, work_control_strict>>;
+extern template class pool_base<work_group_elastic, work_queue_lifo<>, work_control_default>;
+extern template class pool_base<work_group_elastic, work_queue_lifo<>, work_control_strict>;
+extern template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_stats<>>;
+extern template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_stats<work_control_strict>>;
+extern template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_trace<>>;
+extern template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_trace<work_control_strict>>;
 #endif  // PARACHUTE_COMPILED
 
 }  // namespace para
\ No newline at end of file
@@ -6,20 +6,104 @@
 #pragma once
 
 // C++ Standard Library
+#include <atomic>
 #include <condition_variable>
+#include <cstddef>
 #include <mutex>
 #include <thread>
+#include <type_traits>
 #include <utility>
 
+// Parachute
+#include <parachute/idle_policy.hpp>
+#include <parachute/stats_policy.hpp>
+#include <parachute/trace.hpp>
+
 namespace para
 {
+namespace detail
+{
+
+/**
+ * @brief Checks if a work queue synchronizes concurrent access itself
+ *
+ * Such work queues declare <code>static constexpr bool is_concurrent = true</code> and provide a thread-safe
+ * <code>try_pop()</code>, which returns an optional job, in place of <code>pop()</code>
+ */
+template <typename WorkQueueT, typename = void> struct is_concurrent_work_queue : std::false_type
+{};
+
+template <typename WorkQueueT>
+struct is_concurrent_work_queue<WorkQueueT, std::void_t<decltype(WorkQueueT::is_concurrent)>>
+    : std::bool_constant<WorkQueueT::is_concurrent>
+{};
+
+template <typename WorkQueueT>
+inline constexpr bool is_concurrent_work_queue_v = is_concurrent_work_queue<WorkQueueT>::value;
+
+/**
+ * @brief Checks if a work group adds and retires workers while running
+ *
+ * Such work groups declare <code>static constexpr bool is_elastic = true</code> and provide
+ * <code>idle_timeout()</code>, <code>should_grow(queued)</code>, <code>grow()</code> and <code>try_retire()</code>
+ * (see <code>work_group_elastic</code>)
+ */
+template <typename WorkGroupT, typename = void> struct is_elastic_work_group : std::false_type
+{};
+
+template <typename WorkGroupT>
+struct is_elastic_work_group<WorkGroupT, std::void_t<decltype(WorkGroupT::is_elastic)>>
+    : std::bool_constant<WorkGroupT::is_elastic>
+{};
+
+template <typename WorkGroupT>
+inline constexpr bool is_elastic_work_group_v = is_elastic_work_group<WorkGroupT>::value;
+
+/**
+ * @brief Checks if a concurrent work queue provides <code>try_pop_external()</code>, which pops work for a thread that
+ *        is not one of its workers (e.g. <code>work_queue_stealing</code>, whose <code>try_pop()</code> registers
+ *        the calling thread as a worker)
+ */
+template <typename WorkQueueT, typename = void> struct has_try_pop_external : std::false_type
+{};
+
+template <typename WorkQueueT>
+struct has_try_pop_external<WorkQueueT, std::void_t<decltype(std::declval<WorkQueueT&>().try_pop_external())>>
+    : std::true_type
+{};
+
+template <typename WorkQueueT> inline constexpr bool has_try_pop_external_v = has_try_pop_external<WorkQueueT>::value;
+
+}  // namespace detail
 
 /**
  * @brief Represents a pool of 1 of workers (typically threads) which participate in executing enqueued work
+ *
+ * @note if <code>WorkQueueT</code> is concurrent (see <code>detail::is_concurrent_work_queue</code>), work is enqueued
+ *       and popped without locking; <code>WorkControlT::check</code> is then evaluated each time a worker runs out
+ *       of work
+ *
+ * @note if <code>WorkGroupT</code> is elastic (see <code>detail::is_elastic_work_group</code>), a worker is added when
+ *       work is enqueued while no worker is parked, and a parked worker which times out with no work queued retires
+ *
+ * @note if <code>WorkControlT::stats_policy</code> keeps statistics (e.g. <code>stats_per_worker</code>), each job is
+ *       stamped with its enqueue time, and workers count and time the work they do; see <code>stats()</code>
+ *
+ * @note if <code>WorkControlT::trace_policy</code> records events (e.g. <code>trace_events</code>), job enqueue,
+ *       start and end, time spent enqueueing and time workers spend idle are recorded; see <code>dump_trace</code>
  */
 template <typename WorkGroupT, typename WorkQueueT, typename WorkControlT> class pool_base
 {
 public:
+  /// What workers do when they run out of work; <code>WorkControlT::idle_policy</code>, or <code>idle_park</code>
+  using idle_policy = detail::idle_policy_of_t<WorkControlT>;
+
+  /// What statistics workers keep; <code>WorkControlT::stats_policy</code>, or <code>stats_disabled</code>
+  using stats_policy = detail::stats_policy_of_t<WorkControlT>;
+
+  /// What trace events are recorded; <code>WorkControlT::trace_policy</code>, or <code>trace_disabled</code>
+  using trace_policy = detail::trace_policy_of_t<WorkControlT>;
+
   /**
    * @brief Initializes workers
    *
@@ -30,33 +114,7 @@ public:
   template <typename... WorkGroupArgTs>
   explicit pool_base(WorkControlT&& work_control, WorkGroupArgTs&&... work_group_args)
       : worker_control_{ std::move(work_control) }
-      , workers_{ [this]() {
-                   std::unique_lock lock{ work_queue_mutex_ };
-                   // Keep doing work until stopped
-                   while (worker_control_.check(work_queue_))
-                   {
-                     if (work_queue_.empty())
-                     {
-                       // If no work is available, wait for emplace
-                       work_queue_cv_.wait(lock);
-                     }
-                     else
-                     {
-                       // Get next work to do
-                       auto next_to_run = work_queue_.pop();
-
-                       // Unlock queue lock
-                       lock.unlock();
-
-                       // Do the work
-                       next_to_run();
-
-                       // Lock queue lock
-                       lock.lock();
-                     }
-                   }
-                 },
-                  std::forward<WorkGroupArgTs>(work_group_args)... }
+      , workers_{ [this]() { work_loop(); }, std::forward<WorkGroupArgTs>(work_group_args)... }
   {}
 
   /**
@@ -72,18 +130,128 @@ public:
 
   /**
    * @brief Enqueues new work
+   *
+   * Wakes a worker only if one is parked
    */
   template <typename WorkT> void emplace(WorkT&& work)
   {
-    // Adds work under lock
+    emplace_batch([this, &work](auto& queue) {
+      queue.enqueue(instrument(std::forward<WorkT>(work)));
+      return std::size_t{ 1 };
+    });
+  }
+
+  /**
+   * @brief Enqueues new work at level \c priority
+   *
+   * @note only available if <code>WorkQueueT</code> provides <code>enqueue(work, priority)</code> (e.g.
+   *       <code>work_queue_priority</code>)
+   */
+  template <typename WorkT> void emplace(WorkT&& work, const std::size_t priority)
+  {
+    emplace_batch([this, &work, priority](auto& queue) {
+      queue.enqueue(instrument(std::forward<WorkT>(work)), priority);
+      return std::size_t{ 1 };
+    });
+  }
+
+  /**
+   * @brief Enqueues each unit of work in [first, last)
+   *
+   * All work is enqueued under a single lock, after which at most one sleeping worker per unit of work is woken
+   */
+  template <typename WorkIt> void emplace_bulk(WorkIt first, const WorkIt last)
+  {
+    std::size_t n = 0;
+    emplace_batch([this, &first, last, &n](auto& queue) {
+      for (; first != last; ++first, ++n)
+      {
+        queue.enqueue(instrument(*first));
+      }
+      return n;
+    });
+  }
+
+  /**
+   * @brief Enqueues \c n units of work, <code>generator(0) ... generator(n - 1)</code>, in that order
+   *
+   * All work is enqueued under a single lock, after which at most one sleeping worker per unit of work is woken
+   */
+  template <typename GeneratorT> void emplace_n(const std::size_t n, GeneratorT&& generator)
+  {
+    emplace_batch([this, n, &generator](auto& queue) {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        queue.enqueue(instrument(generator(i)));
+      }
+      return n;
+    });
+  }
+
+  /**
+   * @brief Runs one queued job on the calling thread, if any is queued
+   *
+   * Lets a thread which waits on work from this pool (e.g. a worker running nested parallel work) help run queued work
+   * rather than block; see <code>utility::countdown::wait(HelpFnT)</code> and
+   * <code>non_blocking_future::wait(HelpFnT)</code>
+   *
+   * @return true if a job was run
+   */
+  bool try_run_one()
+  {
+    if constexpr (detail::is_concurrent_work_queue_v<WorkQueueT>)
     {
-      std::lock_guard lock{ work_queue_mutex_ };
-      work_queue_.enqueue(std::forward<WorkT>(work));
+      auto next_to_run = [this] {
+        if constexpr (detail::has_try_pop_external_v<WorkQueueT>)
+        {
+          return work_queue_.try_pop_external();
+        }
+        else
+        {
+          return work_queue_.try_pop();
+        }
+      }();
+      if (!next_to_run)
+      {
+        return false;
+      }
+      run(*next_to_run);
+      return true;
+    }
+    else
+    {
+      std::unique_lock lock{ work_queue_mutex_ };
+      if (work_queue_.empty())
+      {
+        return false;
+      }
+      auto next_to_run = work_queue_.pop();
+      if constexpr (tracks_queued_count)
+      {
+        queued_count_.store(queued_count_.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+      }
+      lock.unlock();
+      run(next_to_run);
+      return true;
     }
-    // Signal that work is available
-    work_queue_cv_.notify_one();
   }
 
+  /**
+   * @brief Returns a snapshot of pool statistics, read while workers keep running
+   *
+   * @note only available if <code>stats_policy</code> keeps statistics (e.g. <code>stats_per_worker</code>)
+   */
+  template <typename StatsPolicyT = stats_policy> pool_stats stats() const
+  {
+    static_assert(detail::collects_stats_v<StatsPolicyT>, "pool_base::stats() requires an enabled stats_policy");
+    return stats_.snapshot();
+  }
+
+  /**
+   * @brief Returns number of workers
+   */
+  constexpr std::size_t size() const { return workers_.size(); }
+
   ~pool_base()
   {
     // Stop work loop under look
@@ -96,20 +264,389 @@ public:
   }
 
 private:
+  /// Queue depth is tracked in queued_count_, for a queue which is not concurrent
+  static constexpr bool tracks_queued_count =
+    !detail::is_concurrent_work_queue_v<WorkQueueT> and
+    (detail::idle_polls_v<idle_policy> or detail::is_elastic_work_group_v<WorkGroupT>);
+
+  /// Keeps statistics
+  static constexpr bool collects_stats = detail::collects_stats_v<stats_policy>;
+
+  /// Records trace events
+  static constexpr bool records_trace = detail::records_trace_v<trace_policy>;
+
+  /// Returns \c work, recording its start and end if trace events are recorded
+  template <typename WorkT> decltype(auto) instrument(WorkT&& work)
+  {
+    if constexpr (records_trace)
+    {
+      const char* const label = detail::trace_label_of(work);
+      return [id = detail::trace_enqueue(label), label, w = stamp(std::forward<WorkT>(work))]() mutable {
+        detail::trace_record(detail::trace_event_type::start, id, label);
+        w();
+        detail::trace_record(detail::trace_event_type::end, id, label);
+      };
+    }
+    else
+    {
+      return stamp(std::forward<WorkT>(work));
+    }
+  }
+
+  /// Returns \c work, stamped with its enqueue time if statistics are kept
+  template <typename WorkT> decltype(auto) stamp(WorkT&& work)
+  {
+    if constexpr (collects_stats)
+    {
+      return [this, enqueued_at = detail::stats_clock::now(), w = std::forward<WorkT>(work)]() mutable {
+        stats_.record_start(enqueued_at);
+        w();
+      };
+    }
+    else
+    {
+      return std::forward<WorkT>(work);
+    }
+  }
+
+  /// Runs \c job, counting and timing it if statistics are kept
+  template <typename JobT> void run(JobT& job)
+  {
+    if constexpr (collects_stats)
+    {
+      const auto started_at = detail::stats_clock::now();
+      job();
+      auto& counters = stats_.local();
+      counters.busy_ns.fetch_add(detail::elapsed_ns(started_at), std::memory_order_relaxed);
+      counters.tasks_run.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+      job();
+    }
+  }
+
+  /// Returns <code>idle_fn()</code>, timing it as idle time if statistics are kept, and tracing it as such if trace
+  /// events are recorded
+  template <typename IdleFnT> bool idle(IdleFnT&& idle_fn)
+  {
+    if constexpr (records_trace)
+    {
+      detail::trace_record(detail::trace_event_type::idle_begin);
+      const bool result = idle_stats(std::forward<IdleFnT>(idle_fn));
+      detail::trace_record(detail::trace_event_type::idle_end);
+      return result;
+    }
+    else
+    {
+      return idle_stats(std::forward<IdleFnT>(idle_fn));
+    }
+  }
+
+  /// Returns <code>idle_fn()</code>, timing it as idle time if statistics are kept
+  template <typename IdleFnT> bool idle_stats(IdleFnT&& idle_fn)
+  {
+    if constexpr (collects_stats)
+    {
+      const auto idle_since = detail::stats_clock::now();
+      const bool result = idle_fn();
+      stats_.local().idle_ns.fetch_add(detail::elapsed_ns(idle_since), std::memory_order_relaxed);
+      return result;
+    }
+    else
+    {
+      return idle_fn();
+    }
+  }
+
+  /// Runs <code>enqueue_fn(work_queue_)</code>, which returns the number of jobs it enqueued, then wakes workers;
+  /// traced as time spent enqueueing if trace events are recorded
+  template <typename EnqueueFnT> void emplace_batch(EnqueueFnT&& enqueue_fn)
+  {
+    if constexpr (records_trace)
+    {
+      detail::trace_record(detail::trace_event_type::emplace_begin);
+      emplace_batch_untraced(std::forward<EnqueueFnT>(enqueue_fn));
+      detail::trace_record(detail::trace_event_type::emplace_end);
+    }
+    else
+    {
+      emplace_batch_untraced(std::forward<EnqueueFnT>(enqueue_fn));
+    }
+  }
+
+  /// Runs <code>enqueue_fn(work_queue_)</code>, which returns the number of jobs it enqueued, then wakes workers
+  template <typename EnqueueFnT> void emplace_batch_untraced(EnqueueFnT&& enqueue_fn)
+  {
+    if constexpr (detail::is_concurrent_work_queue_v<WorkQueueT>)
+    {
+      const std::size_t n_enqueued = enqueue_fn(work_queue_);
+      if constexpr (collects_stats)
+      {
+        stats_.record_enqueued(n_enqueued);
+      }
+      notify_concurrent(n_enqueued);
+    }
+    else
+    {
+      std::size_t n_enqueued = 0;
+      std::size_t n_sleeping = 0;
+      std::size_t n_queued = 0;
+      {
+        std::lock_guard lock{ work_queue_mutex_ };
+        n_enqueued = enqueue_fn(work_queue_);
+        n_sleeping = sleeping_count_.load(std::memory_order_relaxed);
+        if constexpr (collects_stats)
+        {
+          stats_.record_enqueued(n_enqueued);
+        }
+        if constexpr (tracks_queued_count)
+        {
+          n_queued = queued_count_.load(std::memory_order_relaxed) + n_enqueued;
+          queued_count_.store(n_queued, std::memory_order_relaxed);
+        }
+      }
+      // Workers which are spinning, rather than parked, find new work without being woken
+      if (n_sleeping > 0)
+      {
+        notify(n_enqueued, n_sleeping);
+      }
+      grow_if_backed_up(n_enqueued, n_sleeping, n_queued);
+    }
+  }
+
+  /// Adds a worker to an elastic work group if more jobs were enqueued than there were parked workers to take them
+  void grow_if_backed_up(
+    [[maybe_unused]] const std::size_t n_enqueued,
+    [[maybe_unused]] const std::size_t n_sleeping,
+    [[maybe_unused]] const std::size_t n_queued)
+  {
+    if constexpr (detail::is_elastic_work_group_v<WorkGroupT>)
+    {
+      if (n_enqueued > n_sleeping and workers_.should_grow(n_queued))
+      {
+        workers_.grow();
+      }
+    }
+  }
+
+  /**
+   * @brief Waits on work_queue_cv_ until woken; \c lock must be held
+   *
+   * @return false if the worker timed out with no work queued, and retired from an elastic work group
+   */
+  bool wait_for_work(std::unique_lock<std::mutex>& lock)
+  {
+    if constexpr (collects_stats)
+    {
+      stats_.local().parks.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool woken = true;
+    if constexpr (detail::is_elastic_work_group_v<WorkGroupT>)
+    {
+      woken = idle([this, &lock] {
+        return work_queue_cv_.wait_for(lock, workers_.idle_timeout()) == std::cv_status::no_timeout;
+      });
+    }
+    else
+    {
+      idle([this, &lock] {
+        work_queue_cv_.wait(lock);
+        return true;
+      });
+    }
+
+    if constexpr (collects_stats)
+    {
+      if (woken)
+      {
+        stats_.local().wakeups.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    if constexpr (detail::is_elastic_work_group_v<WorkGroupT>)
+    {
+      return woken or !work_queue_.empty() or !workers_.try_retire();
+    }
+    else
+    {
+      return true;
+    }
+  }
+
+  /// Wakes up to \c n_enqueued workers, given that \c n_sleeping workers are waiting
+  void notify(const std::size_t n_enqueued, const std::size_t n_sleeping)
+  {
+    if (n_enqueued >= n_sleeping)
+    {
+      work_queue_cv_.notify_all();
+    }
+    else
+    {
+      for (std::size_t i = 0; i < n_enqueued; ++i)
+      {
+        work_queue_cv_.notify_one();
+      }
+    }
+  }
+
+  /// Wakes up to \c n_enqueued workers after work was added to a concurrent queue without locking
+  void notify_concurrent(const std::size_t n_enqueued)
+  {
+    // Order enqueue before reading sleeper count; pairs with fence in work_loop
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const std::size_t n_sleeping = sleeping_count_.load(std::memory_order_relaxed);
+    if (n_sleeping > 0)
+    {
+      // Sleeping workers hold the lock until they are waiting; acquiring it ensures the signal is not lost
+      {
+        std::lock_guard lock{ work_queue_mutex_ };
+      }
+      notify(n_enqueued, n_sleeping);
+    }
+    // Depth of a concurrent queue is not tracked; at least the jobs just enqueued are waiting
+    grow_if_backed_up(n_enqueued, n_sleeping, n_enqueued);
+  }
+
+  /// Runs work until stopped
+  void work_loop()
+  {
+    if constexpr (collects_stats)
+    {
+      stats_.register_worker();
+    }
+
+    if constexpr (detail::is_concurrent_work_queue_v<WorkQueueT>)
+    {
+      // Queue synchronizes itself; only lock when there is no work to do
+      while (true)
+      {
+        // Do work while any is available
+        if (auto next_to_run = work_queue_.try_pop(); next_to_run)
+        {
+          run(*next_to_run);
+          continue;
+        }
+
+        // Poll for a while before parking, if idle policy allows
+        if constexpr (detail::idle_polls_v<idle_policy>)
+        {
+          decltype(work_queue_.try_pop()) polled;
+          if (idle([this, &polled] {
+                return detail::idle_poll<idle_policy>(
+                  [this, &polled] { return (polled = work_queue_.try_pop()).has_value(); });
+              }))
+          {
+            run(*polled);
+            continue;
+          }
+        }
+
+        std::unique_lock lock{ work_queue_mutex_ };
+
+        // Stop when out of work, if requested
+        if (!worker_control_.check(work_queue_))
+        {
+          return;
+        }
+
+        // Advertise that this worker is about to sleep, then check for work enqueued in the meantime
+        sleeping_count_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool retired = false;
+        if (work_queue_.empty())
+        {
+          // If no work is available, wait for emplace
+          retired = !wait_for_work(lock);
+        }
+        sleeping_count_.fetch_sub(1, std::memory_order_relaxed);
+
+        // Leave an elastic work group which has more workers than it needs
+        if (retired)
+        {
+          return;
+        }
+      }
+    }
+    else
+    {
+      std::unique_lock lock{ work_queue_mutex_ };
+      // Keep doing work until stopped
+      while (worker_control_.check(work_queue_))
+      {
+        if (!work_queue_.empty())
+        {
+          // Get next work to do
+          auto next_to_run = work_queue_.pop();
+          if constexpr (tracks_queued_count)
+          {
+            queued_count_.store(queued_count_.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+          }
+
+          // Unlock queue lock
+          lock.unlock();
+
+          // Do the work
+          run(next_to_run);
+
+          // Lock queue lock
+          lock.lock();
+          continue;
+        }
+
+        // Poll for a while before parking, if idle policy allows; work must be re-checked under lock afterwards,
+        // since work enqueued after polling stops (but before this worker parks) does not wake it
+        if constexpr (detail::idle_polls_v<idle_policy>)
+        {
+          lock.unlock();
+          idle([this] {
+            return detail::idle_poll<idle_policy>([this] { return queued_count_.load(std::memory_order_relaxed) > 0; });
+          });
+          lock.lock();
+          if (!work_queue_.empty() or !worker_control_.check(work_queue_))
+          {
+            continue;
+          }
+        }
+
+        // If no work is available, wait for emplace
+        sleeping_count_.fetch_add(1, std::memory_order_relaxed);
+        const bool retired = !wait_for_work(lock);
+        sleeping_count_.fetch_sub(1, std::memory_order_relaxed);
+
+        // Leave an elastic work group which has more workers than it needs
+        if (retired)
+        {
+          return;
+        }
+      }
+    }
+  }
+
   /// Protects concurrent access of work_queue_cv_
   std::mutex work_queue_mutex_;
 
   /// Condition variable to signal new work
   std::condition_variable work_queue_cv_;
 
+  /// Number of workers waiting on work_queue_cv_
+  std::atomic<std::size_t> sleeping_count_ = 0;
+
+  /// Number of jobs in a queue which is not concurrent, read by idle workers without locking; written under lock
+  std::atomic<std::size_t> queued_count_ = 0;
+
   /// Constrains work queue behavior
   WorkControlT worker_control_;
 
   /// Queue of jobs to run
   WorkQueueT work_queue_;
 
+  /// Counters kept by workers, if statistics are kept
+  std::conditional_t<collects_stats, detail::stats_registry, detail::stats_none> stats_;
+
   /// Workers which run jobs
   WorkGroupT workers_;
 };
 
-}  // namespace para
\ No newline at end of file
+}  // namespace para
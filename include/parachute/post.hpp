@@ -6,8 +6,20 @@
 #pragma once
 
 // C++ Standard Library
+#include <atomic>
+#include <cstddef>
 #include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
 #include <type_traits>
+#include <utility>
+#include <vector>
+
+// Parachute
+#include <parachute/task.hpp>
+#include <parachute/trace.hpp>
+#include <parachute/utility/slab.hpp>
 
 namespace std
 {
@@ -20,6 +32,214 @@ namespace para
 template <typename WorkGroupT, typename WorkQueueT, typename WorkPoolOptionsT> class pool_base;
 template <typename T> class non_blocking_promise;
 
+namespace detail
+{
+
+/**
+ * @brief Creates a promise of type \c PromiseT
+ *
+ * Promises which take an allocator (e.g. <code>std::promise</code>) allocate their shared state from a thread-local
+ * slab, so that shared state storage is recycled rather than returned to the heap
+ */
+template <typename PromiseT> PromiseT make_promise()
+{
+  if constexpr (std::uses_allocator_v<PromiseT, utility::slab_allocator<std::byte>>)
+  {
+    return PromiseT{ std::allocator_arg, utility::slab_allocator<std::byte>{} };
+  }
+  else
+  {
+    return PromiseT{};
+  }
+}
+
+/**
+ * @brief Block of promises, with a shared reference count, held in a single allocation
+ *
+ * Each promise is destroyed when it is released (see <code>bulk_promise</code>); the block frees itself when every
+ * promise has been released
+ *
+ * @tparam PromiseT  promise type
+ */
+template <typename PromiseT> class bulk_promises
+{
+public:
+  /**
+   * @brief Creates a block of \c n promises (see <code>make_promise</code>)
+   */
+  static bulk_promises* create(const std::size_t n)
+  {
+    void* const block = ::operator new(promises_offset() + n * sizeof(PromiseT));
+    auto* const self = new (block) bulk_promises{ n };
+    std::size_t i = 0;
+    try
+    {
+      for (; i < n; ++i)
+      {
+        new (self->data() + i) PromiseT{ make_promise<PromiseT>() };
+      }
+    }
+    catch (...)
+    {
+      while (i > 0)
+      {
+        self->data()[--i].~PromiseT();
+      }
+      self->~bulk_promises();
+      ::operator delete(block);
+      throw;
+    }
+    return self;
+  }
+
+  /**
+   * @brief Returns the ith promise
+   */
+  PromiseT& operator[](const std::size_t i) { return data()[i]; }
+
+  /**
+   * @brief Destroys the ith promise, which gives its future a broken promise error if no result was set, then
+   *        releases one reference to the block; frees the block on the last release
+   *
+   * @warning behavior is undefined if the ith promise has already been released
+   */
+  void release(const std::size_t i)
+  {
+    data()[i].~PromiseT();
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+      this->~bulk_promises();
+      ::operator delete(static_cast<void*>(this));
+    }
+  }
+
+private:
+  explicit bulk_promises(const std::size_t n) : remaining_{ n } {}
+
+  /// Returns offset of first promise from the start of the block
+  static constexpr std::size_t promises_offset()
+  {
+    return ((sizeof(bulk_promises) + alignof(PromiseT) - 1) / alignof(PromiseT)) * alignof(PromiseT);
+  }
+
+  /// Returns pointer to first promise
+  PromiseT* data()
+  {
+    return std::launder(reinterpret_cast<PromiseT*>(reinterpret_cast<std::byte*>(this) + promises_offset()));
+  }
+
+  /// Number of promises not yet released
+  std::atomic<std::size_t> remaining_;
+};
+
+/**
+ * @brief Move-only owner of one promise in a <code>bulk_promises</code> block; releases it when destroyed
+ *
+ * Work which is dropped without running (e.g. queued work discarded when a pool is destroyed) thus breaks its promise,
+ * as work enqueued by <code>post</code> does, rather than leaking it
+ */
+template <typename PromiseT> class bulk_promise
+{
+public:
+  bulk_promise(bulk_promises<PromiseT>* const block, const std::size_t index) : block_{ block }, index_{ index } {}
+
+  bulk_promise(bulk_promise&& other) noexcept :
+      block_{ std::exchange(other.block_, nullptr) }, index_{ other.index_ }
+  {}
+
+  bulk_promise(const bulk_promise&) = delete;
+  bulk_promise& operator=(const bulk_promise&) = delete;
+  bulk_promise& operator=(bulk_promise&&) = delete;
+
+  ~bulk_promise()
+  {
+    if (block_ != nullptr)
+    {
+      block_->release(index_);
+    }
+  }
+
+  /**
+   * @brief Returns the owned promise
+   */
+  PromiseT& operator*() { return (*block_)[index_]; }
+
+private:
+  /// Block holding the promise; null once moved from
+  bulk_promises<PromiseT>* block_;
+  /// Index of the promise in block_
+  std::size_t index_;
+};
+
+/**
+ * @brief Sets \c promise from the result of \c work, or from the exception it throws
+ */
+template <typename ResultT, typename PromiseT, typename WorkT> void fulfill(PromiseT& promise, WorkT& work)
+{
+  try
+  {
+    if constexpr (std::is_same_v<ResultT, void>)
+    {
+      work();
+      promise.set_value();
+    }
+    else
+    {
+      promise.set_value(work());
+    }
+  }
+  catch (...)
+  {
+    promise.set_exception(std::current_exception());
+  }
+}
+
+/**
+ * @brief Hands work which sets a promise from the result of \c work to \c enqueue, and returns a tracker for it
+ *
+ * If \c MoveOnlyWorkV, the promise is moved into the enqueued task, rather than allocated on its own; with small work
+ * callables, and recycled shared state storage (see <code>detail::make_promise</code>), posting does not allocate in
+ * steady state. Otherwise (e.g. work queues which hold <code>std::function</code>), the enqueued task must be copyable,
+ * so the promise is shared by its copies, from a slab allocation.
+ *
+ * Either way, the promise is destroyed along with the enqueued task, so work which is dropped without running breaks
+ * its promise
+ *
+ * Enqueued work keeps the trace label of \c work, if it has one (see <code>trace_label</code>)
+ */
+template <
+  template <typename>
+  class PromiseTmpl,
+  bool MoveOnlyWorkV,
+  typename WorkT,
+  typename EnqueueFnT,
+  typename ResultT = std::invoke_result_t<std::remove_reference_t<WorkT>>>
+auto post_with(WorkT&& work, EnqueueFnT&& enqueue)
+{
+  using promise_type = PromiseTmpl<ResultT>;
+  const char* const label = trace_label_of(work);
+  if constexpr (MoveOnlyWorkV)
+  {
+    auto p = make_promise<promise_type>();
+    auto f = p.get_future();
+    enqueue(relabel<WorkT>(label, [p = std::move(p), w = std::forward<WorkT>(work)]() mutable {
+      fulfill<ResultT>(p, w);
+    }));
+    return f;
+  }
+  else
+  {
+    auto p = std::allocate_shared<promise_type>(utility::slab_allocator<promise_type>{}, make_promise<promise_type>());
+    auto f = p->get_future();
+    enqueue(relabel<WorkT>(label, [p = std::move(p), w = std::forward<WorkT>(work)]() mutable {
+      fulfill<ResultT>(*p, w);
+    }));
+    return f;
+  }
+}
+
+}  // namespace detail
+
 namespace strategy
 {
 template <typename T> using blocking = ::std::promise<T>;
@@ -28,6 +248,8 @@ template <typename T> using non_blocking = non_blocking_promise<T>;
 
 /**
  * @brief Enqueues work to a work pool and returns a tracker for that work
+ *
+ * @see detail::post_with
  */
 template <
   template <typename>
@@ -35,32 +257,103 @@ template <
   typename WorkGroupT,
   typename WorkQueueT,
   typename WorkPoolOptionsT,
-  typename WorkT,
-  typename ResultT = std::invoke_result_t<std::remove_reference_t<WorkT>>>
+  typename WorkT>
 [[nodiscard]] auto post(pool_base<WorkGroupT, WorkQueueT, WorkPoolOptionsT>& wp, WorkT&& work)
 {
-  auto p = new PromiseTmpl<ResultT>{};
-  auto f = p->get_future();
-  wp.emplace([p, w = std::forward<WorkT>(work)]() mutable {
-    try
-    {
-      if constexpr (std::is_same_v<ResultT, void>)
+  return detail::post_with<PromiseTmpl, detail::holds_move_only_work_v<WorkQueueT>>(
+    std::forward<WorkT>(work), [&wp](auto&& job) { wp.emplace(std::forward<decltype(job)>(job)); });
+}
+
+/**
+ * @brief Enqueues work to a work pool at level \c priority, and returns a tracker for that work
+ *
+ * @see pool_base::emplace(WorkT&&, std::size_t)
+ */
+template <
+  template <typename>
+  class PromiseTmpl,
+  typename WorkGroupT,
+  typename WorkQueueT,
+  typename WorkPoolOptionsT,
+  typename WorkT>
+[[nodiscard]] auto
+post(pool_base<WorkGroupT, WorkQueueT, WorkPoolOptionsT>& wp, WorkT&& work, const std::size_t priority)
+{
+  return detail::post_with<PromiseTmpl, detail::holds_move_only_work_v<WorkQueueT>>(
+    std::forward<WorkT>(work), [&wp, priority](auto&& job) { wp.emplace(std::forward<decltype(job)>(job), priority); });
+}
+
+/**
+ * @brief Enqueues each unit of work in [first, last) to a work pool and returns a tracker for each, in order
+ *
+ * All work is enqueued at once (see <code>pool_base::emplace_n</code>), and all promises are held in one allocation
+ */
+template <
+  template <typename>
+  class PromiseTmpl,
+  typename WorkGroupT,
+  typename WorkQueueT,
+  typename WorkPoolOptionsT,
+  typename WorkIt,
+  typename WorkT = typename std::iterator_traits<WorkIt>::value_type,
+  typename ResultT = std::invoke_result_t<std::remove_reference_t<WorkT>>>
+[[nodiscard]] auto post_bulk(pool_base<WorkGroupT, WorkQueueT, WorkPoolOptionsT>& wp, WorkIt first, const WorkIt last)
+{
+  using promise_type = PromiseTmpl<ResultT>;
+  using future_type = decltype(std::declval<promise_type&>().get_future());
+
+  const auto n = static_cast<std::size_t>(std::distance(first, last));
+
+  std::vector<future_type> futures;
+  if (n == 0)
+  {
+    return futures;
+  }
+
+  futures.reserve(n);
+  auto* const promises = detail::bulk_promises<promise_type>::create(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    futures.emplace_back((*promises)[i].get_future());
+  }
+
+  // emplace_n generates work in index order, so first is advanced in step with i; each promise is owned by its work
+  // from the moment that work is generated. Work which must be copyable shares ownership of its promise between its
+  // copies (see <code>detail::post_with</code>)
+  std::size_t n_owned = 0;
+  try
+  {
+    wp.emplace_n(n, [promises, &first, &n_owned](const std::size_t i) {
+      const char* const label = detail::trace_label_of(*first);
+      if constexpr (detail::holds_move_only_work_v<WorkQueueT>)
       {
-        w();
-        p->set_value();
+        detail::bulk_promise<promise_type> owned{ promises, i };
+        ++n_owned;
+        return detail::relabel<WorkT>(label, [p = std::move(owned), w = WorkT{ *first++ }]() mutable {
+          detail::fulfill<ResultT>(*p, w);
+        });
       }
       else
       {
-        p->set_value(w());
+        auto owned = std::allocate_shared<detail::bulk_promise<promise_type>>(
+          utility::slab_allocator<detail::bulk_promise<promise_type>>{}, promises, i);
+        ++n_owned;
+        return detail::relabel<WorkT>(label, [p = std::move(owned), w = WorkT{ *first++ }]() mutable {
+          detail::fulfill<ResultT>(**p, w);
+        });
       }
-    }
-    catch (...)
+    });
+  }
+  catch (...)
+  {
+    // Release promises which no work was generated for
+    for (std::size_t i = n_owned; i < n; ++i)
     {
-      p->set_exception(std::current_exception());
+      promises->release(i);
     }
-    delete p;
-  });
-  return f;
+    throw;
+  }
+  return futures;
 }
 
 /**
@@ -71,4 +364,21 @@ template <typename PoolT, typename WorkT> [[nodiscard]] decltype(auto) post(Pool
   return post<strategy::blocking>(std::forward<PoolT>(pool), std::forward<WorkT>(work));
 }
 
+/**
+ * @brief Enqueues work to a work pool at level \c priority, and returns a tracker for that work
+ */
+template <typename PoolT, typename WorkT>
+[[nodiscard]] decltype(auto) post(PoolT&& pool, WorkT&& work, const std::size_t priority)
+{
+  return post<strategy::blocking>(std::forward<PoolT>(pool), std::forward<WorkT>(work), priority);
+}
+
+/**
+ * @brief Enqueues each unit of work in [first, last) to a work pool and returns a tracker for each, in order
+ */
+template <typename PoolT, typename WorkIt> [[nodiscard]] decltype(auto) post_bulk(PoolT&& pool, WorkIt first, WorkIt last)
+{
+  return post_bulk<strategy::blocking>(std::forward<PoolT>(pool), first, last);
+}
+
 }  // namespace para
@@ -0,0 +1,326 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file stats_policy.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+// Parachute
+#include <parachute/utility/cache_line.hpp>
+
+namespace para
+{
+
+/**
+ * @brief Stats policy under which a pool keeps no statistics; costs nothing
+ */
+struct stats_disabled
+{
+  /// Pool keeps statistics
+  static constexpr bool enabled = false;
+};
+
+/**
+ * @brief Stats policy under which each worker keeps its own counters, on its own cache line
+ *
+ * Each job is stamped with its enqueue time, so that enqueue-to-start latency may be recorded when it starts; each
+ * worker also times the jobs it runs, and the time it spends idle
+ */
+struct stats_per_worker
+{
+  /// Pool keeps statistics
+  static constexpr bool enabled = true;
+};
+
+/// Number of buckets in an enqueue-to-start latency histogram
+inline constexpr std::size_t latency_bucket_count = 32;
+
+/**
+ * @brief Counters kept by one worker of a pool
+ */
+struct worker_stats
+{
+  /// Number of jobs run
+  std::uint64_t tasks_run = 0;
+  /// Time spent running jobs, in nanoseconds
+  std::uint64_t busy_ns = 0;
+  /// Time spent polling for work, or parked, in nanoseconds
+  std::uint64_t idle_ns = 0;
+  /// Number of times the worker parked
+  std::uint64_t parks = 0;
+  /// Number of times the worker was woken while parked
+  std::uint64_t wakeups = 0;
+  /// Enqueue-to-start latency histogram; bucket 0 counts latencies under 1ns, and bucket i counts latencies in
+  /// [2^(i-1), 2^i) ns. The last bucket also counts all longer latencies.
+  std::array<std::uint64_t, latency_bucket_count> latency_histogram = {};
+
+  /**
+   * @brief Returns upper bound, in nanoseconds, of latencies counted in bucket \c i
+   */
+  static constexpr std::uint64_t latency_bucket_upper_ns(const std::size_t i) { return std::uint64_t{ 1 } << i; }
+
+  /**
+   * @brief Returns number of jobs started
+   */
+  std::uint64_t tasks_started() const
+  {
+    std::uint64_t n = 0;
+    for (const auto count : latency_histogram)
+    {
+      n += count;
+    }
+    return n;
+  }
+
+  /**
+   * @brief Returns upper bound of the bucket which holds quantile \c q (e.g. 0.99) of enqueue-to-start latency
+   *
+   * @return latency, in nanoseconds; 0 if no jobs were started
+   */
+  std::uint64_t latency_quantile_ns(const double q) const
+  {
+    const std::uint64_t n = tasks_started();
+    if (n == 0)
+    {
+      return 0;
+    }
+    const auto rank = static_cast<std::uint64_t>(q * static_cast<double>(n - 1));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < latency_bucket_count; ++i)
+    {
+      seen += latency_histogram[i];
+      if (seen > rank)
+      {
+        return latency_bucket_upper_ns(i);
+      }
+    }
+    return latency_bucket_upper_ns(latency_bucket_count - 1);
+  }
+
+  /**
+   * @brief Adds counters of \c other to these
+   */
+  worker_stats& operator+=(const worker_stats& other)
+  {
+    tasks_run += other.tasks_run;
+    busy_ns += other.busy_ns;
+    idle_ns += other.idle_ns;
+    parks += other.parks;
+    wakeups += other.wakeups;
+    for (std::size_t i = 0; i < latency_bucket_count; ++i)
+    {
+      latency_histogram[i] += other.latency_histogram[i];
+    }
+    return *this;
+  }
+};
+
+/**
+ * @brief Snapshot of the statistics of a pool
+ *
+ * Counters are read one at a time while workers keep running, so they are each up-to-date, but not necessarily
+ * consistent with one another
+ */
+struct pool_stats
+{
+  /// Counters of each worker which has started, including workers which have since retired
+  std::vector<worker_stats> workers;
+  /// Counters of threads other than workers which ran jobs (see <code>pool_base::try_run_one</code>)
+  worker_stats external;
+  /// Sum of all workers and external counters
+  worker_stats total;
+  /// Number of jobs enqueued
+  std::uint64_t enqueued = 0;
+  /// Number of jobs enqueued, but not yet started
+  std::uint64_t queued = 0;
+};
+
+namespace detail
+{
+
+/**
+ * @brief Stats policy of a work control type; <code>WorkControlT::stats_policy</code>, if declared, else
+ *        <code>stats_disabled</code>
+ */
+template <typename WorkControlT, typename = void> struct stats_policy_of
+{
+  using type = stats_disabled;
+};
+
+template <typename WorkControlT>
+struct stats_policy_of<WorkControlT, std::void_t<typename WorkControlT::stats_policy>>
+{
+  using type = typename WorkControlT::stats_policy;
+};
+
+template <typename WorkControlT> using stats_policy_of_t = typename stats_policy_of<WorkControlT>::type;
+
+/**
+ * @brief Returns true if \c StatsPolicyT keeps statistics
+ */
+template <typename StatsPolicyT> inline constexpr bool collects_stats_v = StatsPolicyT::enabled;
+
+/// Clock used to time jobs
+using stats_clock = std::chrono::steady_clock;
+
+/**
+ * @brief Returns latency histogram bucket which counts \c latency_ns
+ */
+constexpr std::size_t latency_bucket(std::uint64_t latency_ns)
+{
+  std::size_t bucket = 0;
+  for (; latency_ns > 0 and bucket + 1 < latency_bucket_count; latency_ns >>= 1)
+  {
+    ++bucket;
+  }
+  return bucket;
+}
+
+/**
+ * @brief Returns nanoseconds elapsed since \c since
+ */
+inline std::uint64_t elapsed_ns(const stats_clock::time_point since)
+{
+  return static_cast<std::uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(stats_clock::now() - since).count());
+}
+
+/**
+ * @brief Live counters of one worker; see <code>worker_stats</code>
+ *
+ * Written with relaxed atomic adds, on a cache line of their own, so that reading a snapshot neither blocks nor tears
+ * counters, and workers do not contend with one another
+ */
+struct alignas(utility::cache_line_size) worker_stats_counters
+{
+  std::atomic<std::uint64_t> tasks_run = 0;
+  std::atomic<std::uint64_t> busy_ns = 0;
+  std::atomic<std::uint64_t> idle_ns = 0;
+  std::atomic<std::uint64_t> parks = 0;
+  std::atomic<std::uint64_t> wakeups = 0;
+  std::array<std::atomic<std::uint64_t>, latency_bucket_count> latency_histogram = {};
+
+  /// Returns current counter values
+  worker_stats load() const
+  {
+    worker_stats stats;
+    stats.tasks_run = tasks_run.load(std::memory_order_relaxed);
+    stats.busy_ns = busy_ns.load(std::memory_order_relaxed);
+    stats.idle_ns = idle_ns.load(std::memory_order_relaxed);
+    stats.parks = parks.load(std::memory_order_relaxed);
+    stats.wakeups = wakeups.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < latency_bucket_count; ++i)
+    {
+      stats.latency_histogram[i] = latency_histogram[i].load(std::memory_order_relaxed);
+    }
+    return stats;
+  }
+};
+
+/**
+ * @brief Counters of every worker of one pool, plus shared counters for other threads which run its jobs
+ */
+class stats_registry
+{
+public:
+  /**
+   * @brief Gives the calling thread, a worker which is starting, its own counters
+   */
+  void register_worker()
+  {
+    std::lock_guard lock{ workers_mutex_ };
+    auto& counters = workers_.emplace_back();
+    local_state() = { this, &counters };
+  }
+
+  /**
+   * @brief Returns counters of the calling thread; shared external counters, if it is not a worker
+   */
+  worker_stats_counters& local()
+  {
+    const auto& state = local_state();
+    return (state.owner == this) ? *state.counters : external_;
+  }
+
+  /**
+   * @brief Counts \c n enqueued jobs
+   */
+  void record_enqueued(const std::size_t n) { enqueued_.fetch_add(n, std::memory_order_relaxed); }
+
+  /**
+   * @brief Counts a job enqueued at \c enqueued_at, which is starting on the calling thread
+   */
+  void record_start(const stats_clock::time_point enqueued_at)
+  {
+    local().latency_histogram[latency_bucket(elapsed_ns(enqueued_at))].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Returns a snapshot of all counters
+   */
+  pool_stats snapshot() const
+  {
+    pool_stats stats;
+    {
+      std::lock_guard lock{ workers_mutex_ };
+      stats.workers.reserve(workers_.size());
+      for (const auto& counters : workers_)
+      {
+        stats.workers.push_back(counters.load());
+        stats.total += stats.workers.back();
+      }
+    }
+    stats.external = external_.load();
+    stats.total += stats.external;
+    stats.enqueued = enqueued_.load(std::memory_order_relaxed);
+    const std::uint64_t started = stats.total.tasks_started();
+    stats.queued = (stats.enqueued > started) ? (stats.enqueued - started) : 0;
+    return stats;
+  }
+
+private:
+  /**
+   * @brief Registry which the calling thread is a worker of, and its counters there
+   */
+  struct worker_state
+  {
+    const stats_registry* owner = nullptr;
+    worker_stats_counters* counters = nullptr;
+  };
+
+  /// Returns registration of the calling thread
+  static worker_state& local_state()
+  {
+    static thread_local worker_state state;
+    return state;
+  }
+
+  /// Protects workers_
+  mutable std::mutex workers_mutex_;
+  /// Counters of each worker; a deque, so that counters stay put as workers are added
+  std::deque<worker_stats_counters> workers_;
+  /// Counters of threads which are not workers
+  worker_stats_counters external_;
+  /// Number of jobs enqueued
+  alignas(utility::cache_line_size) std::atomic<std::uint64_t> enqueued_ = 0;
+};
+
+/**
+ * @brief Stands in for <code>stats_registry</code> when statistics are disabled
+ */
+struct stats_none
+{};
+
+}  // namespace detail
+}  // namespace para
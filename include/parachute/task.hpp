@@ -0,0 +1,195 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file task.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace para
+{
+
+/**
+ * @brief Move-only, type-erased <code>void()</code> callable with small-buffer storage
+ *
+ * Callables which fit in \c BufferBytesV bytes, and which are nothrow move constructible, are stored inline; all
+ * others are stored on the heap. Invoking a task costs a single indirect call.
+ *
+ * Unlike <code>std::function</code>, the held callable does not need to be copyable, so it may capture move-only
+ * values such as <code>std::unique_ptr</code> or <code>std::promise</code>.
+ *
+ * @tparam BufferBytesV  size of inline callable storage, in bytes
+ */
+template <std::size_t BufferBytesV> class basic_task
+{
+  static_assert(BufferBytesV >= sizeof(void*), "basic_task<N> must be able to hold a pointer inline");
+
+public:
+  /**
+   * @brief Creates an empty task
+   */
+  basic_task() = default;
+
+  /**
+   * @brief Creates a task which holds callable \c fn
+   */
+  template <
+    typename FnT,
+    typename = std::enable_if_t<
+      !std::is_same_v<std::decay_t<FnT>, basic_task> and std::is_invocable_r_v<void, std::decay_t<FnT>&>>>
+  basic_task(FnT&& fn)
+  {
+    using callable_type = std::decay_t<FnT>;
+    if constexpr (is_inline_v<callable_type>)
+    {
+      new (buffer_) callable_type(std::forward<FnT>(fn));
+      invoke_ = &invoke_inline<callable_type>;
+      manage_ = &manage_inline<callable_type>;
+    }
+    else
+    {
+      new (buffer_) callable_type*(new callable_type(std::forward<FnT>(fn)));
+      invoke_ = &invoke_heap<callable_type>;
+      manage_ = &manage_heap<callable_type>;
+    }
+  }
+
+  basic_task(const basic_task&) = delete;
+
+  basic_task(basic_task&& other) noexcept { take(other); }
+
+  basic_task& operator=(const basic_task&) = delete;
+
+  basic_task& operator=(basic_task&& other) noexcept
+  {
+    if (this != &other)
+    {
+      reset();
+      take(other);
+    }
+    return *this;
+  }
+
+  ~basic_task() { reset(); }
+
+  /**
+   * @brief Invokes held callable
+   * @warning behavior is undefined if <code>valid() == false</code>
+   */
+  void operator()() { invoke_(buffer_); }
+
+  /**
+   * @brief Returns true if task holds a callable
+   */
+  constexpr bool valid() const { return invoke_ != nullptr; }
+
+  /**
+   * @copydoc valid
+   */
+  constexpr explicit operator bool() const { return valid(); }
+
+  /**
+   * @brief Returns true if callables of type \c FnT are stored without a heap allocation
+   */
+  template <typename FnT>
+  static constexpr bool is_inline_v = sizeof(FnT) <= BufferBytesV and alignof(FnT) <= alignof(std::max_align_t) and
+    std::is_nothrow_move_constructible_v<FnT>;
+
+private:
+  /// Operations on held callable, other than invocation
+  enum class operation
+  {
+    relocate,  ///< move callable from src to dst, then destroy src
+    destroy  ///< destroy callable at src
+  };
+
+  template <typename FnT> static void invoke_inline(void* storage) { (*std::launder(reinterpret_cast<FnT*>(storage)))(); }
+
+  template <typename FnT> static void manage_inline(operation op, void* dst, void* src) noexcept
+  {
+    auto* const fn = std::launder(reinterpret_cast<FnT*>(src));
+    if (op == operation::relocate)
+    {
+      new (dst) FnT(std::move(*fn));
+    }
+    fn->~FnT();
+  }
+
+  template <typename FnT> static void invoke_heap(void* storage) { (**std::launder(reinterpret_cast<FnT**>(storage)))(); }
+
+  template <typename FnT> static void manage_heap(operation op, void* dst, void* src) noexcept
+  {
+    auto* const fn = *std::launder(reinterpret_cast<FnT**>(src));
+    if (op == operation::relocate)
+    {
+      new (dst) FnT*(fn);
+    }
+    else
+    {
+      delete fn;
+    }
+  }
+
+  /// Moves held callable from other, leaving it empty
+  void take(basic_task& other) noexcept
+  {
+    if (other.valid())
+    {
+      other.manage_(operation::relocate, buffer_, other.buffer_);
+      invoke_ = std::exchange(other.invoke_, nullptr);
+      manage_ = std::exchange(other.manage_, nullptr);
+    }
+  }
+
+  /// Destroys held callable, leaving task empty
+  void reset() noexcept
+  {
+    if (valid())
+    {
+      manage_(operation::destroy, nullptr, buffer_);
+      invoke_ = nullptr;
+      manage_ = nullptr;
+    }
+  }
+
+  /// Callable storage; holds either the callable itself or a pointer to it
+  alignas(std::max_align_t) std::byte buffer_[BufferBytesV];
+  /// Invokes held callable
+  void (*invoke_)(void*) = nullptr;
+  /// Relocates or destroys held callable
+  void (*manage_)(operation, void*, void*) noexcept = nullptr;
+};
+
+/**
+ * @brief Default task type; 48 bytes of inline storage, 64 bytes in total
+ */
+using task = basic_task<48>;
+
+namespace detail
+{
+
+/**
+ * @brief Checks if a work queue can hold move-only work
+ *
+ * Work queues which declare <code>using work_storage_type = ...</code> hold move-only work unless that storage is
+ * copyable (e.g. <code>std::function</code>, whose targets must be copy constructible); work queues which declare no
+ * storage type are assumed to hold move-only work
+ */
+template <typename WorkQueueT, typename = void> struct holds_move_only_work : std::true_type
+{};
+
+template <typename WorkQueueT>
+struct holds_move_only_work<WorkQueueT, std::void_t<typename WorkQueueT::work_storage_type>>
+    : std::bool_constant<!std::is_copy_constructible_v<typename WorkQueueT::work_storage_type>>
+{};
+
+template <typename WorkQueueT> inline constexpr bool holds_move_only_work_v = holds_move_only_work<WorkQueueT>::value;
+
+}  // namespace detail
+
+}  // namespace para
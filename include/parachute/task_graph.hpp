@@ -0,0 +1,222 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file task_graph.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+// Parachute
+#include <parachute/non_blocking_future.hpp>
+#include <parachute/task.hpp>
+
+namespace para
+{
+
+/**
+ * @brief Directed acyclic graph of tasks, which may be run repeatedly on a pool
+ *
+ * Nodes and edges are declared once. On each <code>run</code>, every node counts its unfinished predecessors with an
+ * atomic counter; a node is scheduled by whichever predecessor finishes last, so no pool thread ever blocks waiting
+ * on another node. A finishing node runs one of its newly ready successors inline, and enqueues the others.
+ *
+ * Storage for per-run state is kept between runs, and is only reallocated after nodes are added.
+ */
+class task_graph
+{
+public:
+  /// Identifies a node within its graph
+  using node_id = std::size_t;
+
+  task_graph() = default;
+
+  task_graph(const task_graph&) = delete;
+
+  task_graph& operator=(const task_graph&) = delete;
+
+  /**
+   * @brief Adds a node which runs \c work
+   *
+   * @return id of the new node
+   */
+  template <typename WorkT> node_id emplace(WorkT&& work)
+  {
+    nodes_.push_back(node{ task{ std::forward<WorkT>(work) }, {}, 0 });
+    return nodes_.size() - 1;
+  }
+
+  /**
+   * @brief Adds an edge, such that node \c before finishes before node \c after starts
+   *
+   * @warning edges must not form a cycle; a graph with a cycle never finishes
+   */
+  void precede(const node_id before, const node_id after)
+  {
+    nodes_[before].successors.push_back(after);
+    ++nodes_[after].predecessor_count;
+  }
+
+  /**
+   * @brief Returns number of nodes
+   */
+  std::size_t size() const { return nodes_.size(); }
+
+  /**
+   * @brief Runs all nodes on \c pool, in dependency order
+   *
+   * If a node throws, nodes which have not yet started are skipped, and the returned future holds the exception.
+   *
+   * @param pool  pool (e.g. <code>pool_base</code>) which runs nodes; must outlive the run
+   *
+   * @return future which becomes ready once every node has finished (or been skipped)
+   *
+   * @warning graph must not be modified, or run again, until the returned future is ready
+   */
+  template <typename PoolT> [[nodiscard]] non_blocking_future<void> run(PoolT& pool)
+  {
+    promise_.emplace();
+    auto future = promise_->get_future();
+
+    if (nodes_.empty())
+    {
+      finish();
+      return future;
+    }
+
+    if (pending_size_ != nodes_.size())
+    {
+      pending_ = std::make_unique<std::atomic<std::size_t>[]>(nodes_.size());
+      pending_size_ = nodes_.size();
+    }
+
+    roots_.clear();
+    for (node_id id = 0; id < nodes_.size(); ++id)
+    {
+      pending_[id].store(nodes_[id].predecessor_count, std::memory_order_relaxed);
+      if (nodes_[id].predecessor_count == 0)
+      {
+        roots_.push_back(id);
+      }
+    }
+    remaining_.store(nodes_.size(), std::memory_order_relaxed);
+    failed_.store(false, std::memory_order_relaxed);
+
+    // Enqueueing publishes the counters reset above to the workers
+    pool.emplace_n(roots_.size(), [this, &pool](const std::size_t i) {
+      return [this, &pool, id = roots_[i]] { execute(pool, id); };
+    });
+    return future;
+  }
+
+private:
+  /**
+   * @brief Work, and outgoing edges, of a single node
+   */
+  struct node
+  {
+    /// Work run by this node
+    task work;
+    /// Nodes which start after this node finishes
+    std::vector<node_id> successors;
+    /// Number of nodes which finish before this node starts
+    std::size_t predecessor_count;
+  };
+
+  /// Runs node \c id, then any successors it readies; enqueues all but one of them on \c pool
+  template <typename PoolT> void execute(PoolT& pool, node_id id)
+  {
+    while (true)
+    {
+      if (!failed_.load(std::memory_order_relaxed))
+      {
+        try
+        {
+          nodes_[id].work();
+        }
+        catch (...)
+        {
+          fail(std::current_exception());
+        }
+      }
+
+      std::optional<node_id> next;
+      for (const node_id successor : nodes_[id].successors)
+      {
+        if (pending_[successor].fetch_sub(1, std::memory_order_acq_rel) != 1)
+        {
+          continue;
+        }
+        else if (next.has_value())
+        {
+          pool.emplace([this, &pool, successor] { execute(pool, successor); });
+        }
+        else
+        {
+          next = successor;
+        }
+      }
+
+      if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        finish();
+        return;
+      }
+      else if (!next.has_value())
+      {
+        return;
+      }
+      id = *next;
+    }
+  }
+
+  /// Records \c ex, if no other node failed first
+  void fail(std::exception_ptr&& ex)
+  {
+    if (!failed_.exchange(true, std::memory_order_relaxed))
+    {
+      error_ = std::move(ex);
+    }
+  }
+
+  /// Sets graph-wide result; graph may be run again as soon as it is set
+  void finish()
+  {
+    auto promise = std::move(*promise_);
+    promise_.reset();
+    if (error_ != nullptr)
+    {
+      promise.set_exception(std::exchange(error_, nullptr));
+    }
+    else
+    {
+      promise.set_value();
+    }
+  }
+
+  /// All nodes
+  std::vector<node> nodes_;
+  /// Nodes without predecessors
+  std::vector<node_id> roots_;
+  /// Number of unfinished predecessors of each node, during a run
+  std::unique_ptr<std::atomic<std::size_t>[]> pending_;
+  /// Number of counters in <code>pending_</code>
+  std::size_t pending_size_ = 0;
+  /// Number of nodes which have not finished, during a run
+  std::atomic<std::size_t> remaining_ = 0;
+  /// Set once a node throws, during a run
+  std::atomic<bool> failed_ = false;
+  /// First exception thrown by a node
+  std::exception_ptr error_ = nullptr;
+  /// Graph-wide result of the current run
+  std::optional<non_blocking_promise<void>> promise_;
+};
+
+}  // namespace para
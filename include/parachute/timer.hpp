@@ -0,0 +1,339 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file timer.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+// Parachute
+#include <parachute/task.hpp>
+#include <parachute/utility/timer_wheel.hpp>
+
+namespace para
+{
+
+class timer_service;
+
+namespace detail
+{
+
+/**
+ * @brief Timer scheduled on a <code>timer_service</code>
+ */
+struct timer_entry : utility::timer_wheel_node
+{
+  /// Service which the timer is scheduled on
+  timer_service* service = nullptr;
+  /// Ticks between firings; 0 for a timer which fires once
+  std::uint64_t period_ticks = 0;
+  /// Called each time the timer fires, by the timer thread
+  task fire;
+  /// Keeps the timer alive while it is scheduled
+  std::shared_ptr<timer_entry> self;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Handle to a timer scheduled on a <code>timer_service</code>, e.g. by <code>post_after</code>
+ *
+ * Handles may be dropped without cancelling their timers
+ */
+class timer_handle
+{
+public:
+  /**
+   * @brief Creates a handle to no timer
+   */
+  timer_handle() = default;
+
+  /**
+   * @brief Cancels the timer, so that it does not fire again
+   *
+   * Once this returns, the timer is not firing, and will not fire; work it already handed to a pool may still run
+   *
+   * @return true if the timer was still scheduled
+   */
+  inline bool cancel();
+
+  /**
+   * @brief Returns true if the timer is still scheduled, i.e. it has fire(s) left, and was not cancelled
+   */
+  inline bool pending() const;
+
+private:
+  friend class timer_service;
+
+  explicit timer_handle(std::shared_ptr<detail::timer_entry> entry) : entry_{ std::move(entry) } {}
+
+  /// Timer which this handle refers to
+  std::shared_ptr<detail::timer_entry> entry_;
+};
+
+/**
+ * @brief Fires timers from one thread, which sleeps until the next timer is due
+ *
+ * Timers are kept in a hierarchical <code>utility::timer_wheel</code>, so scheduling and cancelling are O(1), and
+ * hundreds of thousands of timers may be pending at once. Timers fire on the first tick at or after their deadline;
+ * they never fire early.
+ *
+ * Timers fire while the service lock is held, so that a timer which has been cancelled is never firing; firing should
+ * therefore only hand work off, e.g. to a pool (see <code>post_after</code>)
+ */
+class timer_service
+{
+public:
+  /// Clock which deadlines are measured on
+  using clock = std::chrono::steady_clock;
+
+  /**
+   * @brief Starts the timer thread
+   *
+   * @param tick  resolution of timer deadlines
+   */
+  explicit timer_service(const clock::duration tick = std::chrono::milliseconds{ 1 }) :
+      tick_{ tick }, origin_{ clock::now() }, thread_{ [this] { loop(); } }
+  {}
+
+  timer_service(const timer_service&) = delete;
+  timer_service& operator=(const timer_service&) = delete;
+
+  /**
+   * @brief Stops the timer thread; pending timers are dropped without firing
+   */
+  ~timer_service()
+  {
+    {
+      std::lock_guard lock{ mutex_ };
+      stopping_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+
+    // Break each pending timer's hold on itself
+    wheel_.clear([](utility::timer_wheel_node& node) {
+      static_cast<detail::timer_entry&>(node).self.reset();
+    });
+  }
+
+  /**
+   * @brief Returns the process-wide timer service, used by <code>post_after</code>, <code>post_at</code> and
+   *        <code>post_every</code>; started on first use
+   */
+  static timer_service& instance()
+  {
+    static timer_service service;
+    return service;
+  }
+
+  /**
+   * @brief Schedules \c fire to be called, by the timer thread, at \c deadline, then every \c period after, if
+   *        \c period is not zero
+   *
+   * Periods shorter than one tick fire once per tick
+   */
+  template <typename FireFnT>
+  timer_handle schedule(const clock::time_point deadline, const clock::duration period, FireFnT&& fire)
+  {
+    auto entry = std::make_shared<detail::timer_entry>();
+    entry->service = this;
+    entry->period_ticks = (period > clock::duration::zero()) ? std::max<std::uint64_t>(1, ticks(period)) : 0;
+    entry->fire = task{ std::forward<FireFnT>(fire) };
+
+    const std::uint64_t expiry = ticks(deadline - origin_);
+    bool wake = false;
+    {
+      std::lock_guard lock{ mutex_ };
+      entry->self = entry;
+      wheel_.insert(*entry, expiry);
+      wake = (entry->expiry < wake_tick_);
+    }
+    // Timer thread sleeps past this deadline; wake it, so that it sleeps until this one instead
+    if (wake)
+    {
+      cv_.notify_one();
+    }
+    return timer_handle{ std::move(entry) };
+  }
+
+  /**
+   * @brief Returns number of pending timers
+   */
+  std::size_t size() const
+  {
+    std::lock_guard lock{ mutex_ };
+    return wheel_.size();
+  }
+
+private:
+  friend class timer_handle;
+
+  /// Returns whole ticks in \c duration, rounded up, so that timers never fire early
+  std::uint64_t ticks(const clock::duration duration) const
+  {
+    if (duration <= clock::duration::zero())
+    {
+      return 0;
+    }
+    return static_cast<std::uint64_t>((duration + tick_ - clock::duration{ 1 }) / tick_);
+  }
+
+  /// Removes \c entry, if it is still scheduled
+  bool cancel(detail::timer_entry& entry)
+  {
+    std::shared_ptr<detail::timer_entry> self;
+    std::lock_guard lock{ mutex_ };
+    if (!entry.linked())
+    {
+      return false;
+    }
+    wheel_.erase(entry);
+    self = std::move(entry.self);
+    return true;
+  }
+
+  /// Returns true if \c entry is still scheduled
+  bool pending(const detail::timer_entry& entry) const
+  {
+    std::lock_guard lock{ mutex_ };
+    return entry.linked();
+  }
+
+  /// Fires timers as they come due, until stopped
+  void loop()
+  {
+    std::unique_lock lock{ mutex_ };
+    while (!stopping_)
+    {
+      const auto now = static_cast<std::uint64_t>((clock::now() - origin_) / tick_);
+      wheel_.advance(now, [this](utility::timer_wheel_node& node) {
+        auto& entry = static_cast<detail::timer_entry&>(node);
+        entry.fire();
+        if (entry.period_ticks > 0)
+        {
+          // Fixed rate; a timer which has fallen behind fires once per tick until it catches up
+          wheel_.insert(entry, entry.expiry + entry.period_ticks);
+        }
+        else
+        {
+          entry.self.reset();
+        }
+      });
+
+      if (const auto next = wheel_.next_tick(); next)
+      {
+        wake_tick_ = *next;
+        cv_.wait_until(lock, origin_ + tick_ * static_cast<clock::rep>(*next));
+      }
+      else
+      {
+        wake_tick_ = std::numeric_limits<std::uint64_t>::max();
+        cv_.wait(lock);
+      }
+    }
+  }
+
+  /// Resolution of timer deadlines
+  clock::duration tick_;
+  /// Time of tick 0
+  clock::time_point origin_;
+  /// Protects all members below
+  mutable std::mutex mutex_;
+  /// Wakes the timer thread
+  std::condition_variable cv_;
+  /// Pending timers
+  utility::timer_wheel<> wheel_;
+  /// Tick which the timer thread sleeps until
+  std::uint64_t wake_tick_ = std::numeric_limits<std::uint64_t>::max();
+  /// Set when the timer thread should stop
+  bool stopping_ = false;
+  /// Timer thread
+  std::thread thread_;
+};
+
+bool timer_handle::cancel() { return entry_ and entry_->service->cancel(*entry_); }
+
+bool timer_handle::pending() const { return entry_ and entry_->service->pending(*entry_); }
+
+namespace detail
+{
+
+/**
+ * @brief Converts \c time_point, on any clock, to a time point on the timer clock
+ */
+template <typename ClockT, typename DurationT>
+timer_service::clock::time_point to_timer_clock(const std::chrono::time_point<ClockT, DurationT>& time_point)
+{
+  if constexpr (std::is_same_v<ClockT, timer_service::clock>)
+  {
+    return std::chrono::time_point_cast<timer_service::clock::duration>(time_point);
+  }
+  else
+  {
+    return timer_service::clock::now() +
+      std::chrono::duration_cast<timer_service::clock::duration>(time_point - ClockT::now());
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Enqueues \c work to \c pool at \c time_point
+ *
+ * @warning \c pool must outlive the timer; cancel it (see <code>timer_handle::cancel</code>) before destroying \c pool,
+ *          even if it has fired, since cancelling waits for a timer which is firing to finish
+ *
+ * @return handle to the timer
+ */
+template <typename PoolT, typename ClockT, typename DurationT, typename WorkT>
+timer_handle post_at(PoolT& pool, const std::chrono::time_point<ClockT, DurationT>& time_point, WorkT&& work)
+{
+  return timer_service::instance().schedule(
+    detail::to_timer_clock(time_point),
+    timer_service::clock::duration::zero(),
+    [&pool, w = std::forward<WorkT>(work)]() mutable { pool.emplace(std::move(w)); });
+}
+
+/**
+ * @brief Enqueues \c work to \c pool once \c delay has elapsed
+ *
+ * @copydetails post_at
+ */
+template <typename PoolT, typename RepT, typename PeriodT, typename WorkT>
+timer_handle post_after(PoolT& pool, const std::chrono::duration<RepT, PeriodT>& delay, WorkT&& work)
+{
+  return timer_service::instance().schedule(
+    timer_service::clock::now() + std::chrono::duration_cast<timer_service::clock::duration>(delay),
+    timer_service::clock::duration::zero(),
+    [&pool, w = std::forward<WorkT>(work)]() mutable { pool.emplace(std::move(w)); });
+}
+
+/**
+ * @brief Enqueues a copy of \c work to \c pool every \c period, starting one \c period from now, until cancelled
+ *
+ * @copydetails post_at
+ */
+template <typename PoolT, typename RepT, typename PeriodT, typename WorkT>
+timer_handle post_every(PoolT& pool, const std::chrono::duration<RepT, PeriodT>& period, WorkT&& work)
+{
+  const auto timer_period = std::chrono::duration_cast<timer_service::clock::duration>(period);
+  return timer_service::instance().schedule(
+    timer_service::clock::now() + timer_period, timer_period, [&pool, w = std::forward<WorkT>(work)] {
+      pool.emplace(w);
+    });
+}
+
+}  // namespace para
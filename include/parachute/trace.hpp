@@ -0,0 +1,510 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file trace.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace para
+{
+
+/**
+ * @brief Trace policy under which a pool records no events; costs nothing
+ */
+struct trace_disabled
+{
+  /// Pool records trace events
+  static constexpr bool enabled = false;
+};
+
+/**
+ * @brief Trace policy under which a pool records task enqueue, start and end events, as well as the time each thread
+ *        spends enqueueing work, and the time each worker spends idle
+ *
+ * Events are kept in per-thread ring buffers, and written out with <code>dump_trace</code>
+ */
+struct trace_events
+{
+  /// Pool records trace events
+  static constexpr bool enabled = true;
+};
+
+/**
+ * @brief Work callable \c WorkT, with a label which names it in traces
+ *
+ * @see trace_label
+ */
+template <typename WorkT> struct labelled_work
+{
+  /// Name of the work in traces; must have static storage duration (e.g. a string literal)
+  const char* label;
+  /// Work to run
+  WorkT work;
+
+  decltype(auto) operator()() { return work(); }
+};
+
+/**
+ * @brief Labels \c work, so that it is named by \c label in traces
+ *
+ * May be passed anywhere work is, e.g. <code>pool.emplace(trace_label("stage-1", fn))</code> or
+ * <code>post(pool, trace_label("stage-1", fn))</code>; pools which do not trace simply run it
+ *
+ * @param label  name of the work; must have static storage duration (e.g. a string literal)
+ * @param work  work to run
+ */
+template <typename WorkT> labelled_work<std::decay_t<WorkT>> trace_label(const char* label, WorkT&& work)
+{
+  return labelled_work<std::decay_t<WorkT>>{ label, std::forward<WorkT>(work) };
+}
+
+namespace detail
+{
+
+/**
+ * @brief Trace policy of a work control type; <code>WorkControlT::trace_policy</code>, if declared, else
+ *        <code>trace_disabled</code>
+ */
+template <typename WorkControlT, typename = void> struct trace_policy_of
+{
+  using type = trace_disabled;
+};
+
+template <typename WorkControlT>
+struct trace_policy_of<WorkControlT, std::void_t<typename WorkControlT::trace_policy>>
+{
+  using type = typename WorkControlT::trace_policy;
+};
+
+template <typename WorkControlT> using trace_policy_of_t = typename trace_policy_of<WorkControlT>::type;
+
+/**
+ * @brief Returns true if \c TracePolicyT records events
+ */
+template <typename TracePolicyT> inline constexpr bool records_trace_v = TracePolicyT::enabled;
+
+template <typename WorkT> struct is_labelled_work : std::false_type
+{};
+
+template <typename WorkT> struct is_labelled_work<labelled_work<WorkT>> : std::true_type
+{};
+
+/**
+ * @brief Returns label of \c work, or \c "task" if it has none
+ */
+template <typename WorkT> const char* trace_label_of([[maybe_unused]] const WorkT& work)
+{
+  if constexpr (is_labelled_work<WorkT>::value)
+  {
+    return work.label;
+  }
+  else
+  {
+    return "task";
+  }
+}
+
+/**
+ * @brief Returns \c wrapper, labelled by \c label, if \c WorkT (which \c wrapper runs) is labelled
+ */
+template <typename WorkT, typename WrapperT>
+auto relabel([[maybe_unused]] const char* const label, WrapperT&& wrapper)
+{
+  if constexpr (is_labelled_work<std::decay_t<WorkT>>::value)
+  {
+    return trace_label(label, std::forward<WrapperT>(wrapper));
+  }
+  else
+  {
+    return std::forward<WrapperT>(wrapper);
+  }
+}
+
+/**
+ * @brief Kinds of recorded trace events
+ */
+enum class trace_event_type : std::uint64_t
+{
+  emplace_begin,  ///< thread starts enqueueing work (including waiting on the queue lock)
+  emplace_end,  ///< thread finishes enqueueing work
+  enqueue,  ///< job was enqueued
+  start,  ///< job starts running
+  end,  ///< job finishes running
+  idle_begin,  ///< worker starts polling for work, or parks
+  idle_end  ///< worker stops polling for work, or wakes
+};
+
+/**
+ * @brief One recorded event
+ */
+struct trace_event
+{
+  /// Nanoseconds since the trace origin
+  std::uint64_t timestamp_ns;
+  /// Job id; 0 for events which are not about a job
+  std::uint64_t id;
+  /// Job label, or name of span
+  const char* label;
+  /// Kind of event
+  trace_event_type type;
+};
+
+/**
+ * @brief Fixed-capacity ring of events, written by one thread at a time; once full, the oldest events are overwritten
+ *
+ * Slots are written with relaxed atomic stores, after a release fence, and published by a release store of the head,
+ * so events may be read while the owning thread keeps writing; events the writer may have overwritten while they were
+ * being read are dropped
+ */
+class trace_ring
+{
+public:
+  /// Number of events held
+  static constexpr std::size_t capacity = std::size_t{ 1 } << 14;
+
+  explicit trace_ring(const std::size_t thread_index) :
+      slots_{ std::make_unique<slot[]>(capacity) }, thread_index_{ thread_index }
+  {}
+
+  /**
+   * @brief Records an event; must only be called by the thread which owns this ring
+   */
+  void push(const trace_event& event)
+  {
+    const std::uint64_t i = head_.load(std::memory_order_relaxed);
+    // Pairs with the acquire fence in for_each: a reader which sees any of the stores below then sees a head of at
+    // least i, and so drops the event this slot held before
+    std::atomic_thread_fence(std::memory_order_release);
+    auto& s = slots_[i % capacity];
+    s.timestamp_ns.store(event.timestamp_ns, std::memory_order_relaxed);
+    s.id.store(event.id, std::memory_order_relaxed);
+    s.label.store(event.label, std::memory_order_relaxed);
+    s.type.store(static_cast<std::uint64_t>(event.type), std::memory_order_relaxed);
+    head_.store(i + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief Calls <code>f(event)</code> on each event held, oldest first
+   */
+  template <typename FnT> void for_each(FnT&& f) const
+  {
+    const std::uint64_t head = head_.load(std::memory_order_acquire);
+    std::vector<trace_event> events;
+    events.reserve(static_cast<std::size_t>(std::min<std::uint64_t>(head, capacity)));
+    for (std::uint64_t i = (head > capacity) ? (head - capacity) : 0; i < head; ++i)
+    {
+      const auto& s = slots_[i % capacity];
+      events.push_back(trace_event{ s.timestamp_ns.load(std::memory_order_relaxed),
+                                    s.id.load(std::memory_order_relaxed),
+                                    s.label.load(std::memory_order_relaxed),
+                                    static_cast<trace_event_type>(s.type.load(std::memory_order_relaxed)) });
+    }
+
+    // Drop events whose slots were (or are being) overwritten since they were read; pairs with the fence in push
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const std::uint64_t overwritten = head_.load(std::memory_order_relaxed) + 1;
+    const std::uint64_t first = (head > capacity) ? (head - capacity) : 0;
+    const std::uint64_t first_valid = (overwritten > capacity) ? (overwritten - capacity) : 0;
+    for (std::uint64_t i = std::max(first, first_valid); i < head; ++i)
+    {
+      f(events[static_cast<std::size_t>(i - first)]);
+    }
+  }
+
+  /**
+   * @brief Returns index of the thread which owns this ring
+   */
+  constexpr std::size_t thread_index() const { return thread_index_; }
+
+  /**
+   * @brief Claims this ring for the calling thread; returns false if another live thread owns it
+   */
+  bool try_claim()
+  {
+    bool expected = false;
+    return owned_.compare_exchange_strong(expected, true, std::memory_order_acq_rel);
+  }
+
+  /**
+   * @brief Releases this ring when its owning thread exits, so that it may be reused by another thread
+   */
+  void release() { owned_.store(false, std::memory_order_release); }
+
+private:
+  /**
+   * @brief Storage for one event
+   */
+  struct slot
+  {
+    std::atomic<std::uint64_t> timestamp_ns = 0;
+    std::atomic<std::uint64_t> id = 0;
+    std::atomic<const char*> label = nullptr;
+    std::atomic<std::uint64_t> type = 0;
+  };
+
+  /// Event storage
+  std::unique_ptr<slot[]> slots_;
+  /// Index of the next event to write
+  std::atomic<std::uint64_t> head_ = 0;
+  /// Index of the thread which owns this ring, used as its trace thread id
+  std::size_t thread_index_;
+  /// Set while a live thread owns this ring
+  std::atomic<bool> owned_ = false;
+};
+
+/**
+ * @brief Process-wide set of trace rings, one per thread which has recorded events
+ */
+class trace_registry
+{
+public:
+  /**
+   * @brief Returns the process-wide registry
+   */
+  static trace_registry& instance()
+  {
+    static trace_registry registry;
+    return registry;
+  }
+
+  /**
+   * @brief Records an event of \c type, now, on the calling thread's ring
+   */
+  void record(const trace_event_type type, const std::uint64_t id, const char* const label)
+  {
+    local().push(trace_event{ now_ns(), id, label, type });
+  }
+
+  /**
+   * @brief Returns a new job id
+   */
+  std::uint64_t next_id() { return next_id_.fetch_add(1, std::memory_order_relaxed); }
+
+  /**
+   * @brief Calls <code>f(ring)</code> on each ring
+   */
+  template <typename FnT> void for_each_ring(FnT&& f) const
+  {
+    std::lock_guard lock{ rings_mutex_ };
+    for (const auto& ring : rings_)
+    {
+      f(*ring);
+    }
+  }
+
+private:
+  trace_registry() = default;
+
+  /**
+   * @brief Releases the ring of a thread when it exits
+   */
+  struct ring_handle
+  {
+    std::shared_ptr<trace_ring> ring;
+
+    ~ring_handle()
+    {
+      if (ring)
+      {
+        ring->release();
+      }
+    }
+  };
+
+  /// Returns nanoseconds since the trace origin
+  std::uint64_t now_ns() const
+  {
+    return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin_).count());
+  }
+
+  /// Returns ring of the calling thread; claims one, reusing a ring of an exited thread if possible, on first use
+  trace_ring& local()
+  {
+    static thread_local ring_handle handle;
+    if (!handle.ring)
+    {
+      std::lock_guard lock{ rings_mutex_ };
+      for (const auto& ring : rings_)
+      {
+        if (ring->try_claim())
+        {
+          handle.ring = ring;
+          return *handle.ring;
+        }
+      }
+      rings_.push_back(std::make_shared<trace_ring>(rings_.size() + 1));
+      rings_.back()->try_claim();
+      handle.ring = rings_.back();
+    }
+    return *handle.ring;
+  }
+
+  /// Time which trace timestamps are relative to
+  std::chrono::steady_clock::time_point origin_ = std::chrono::steady_clock::now();
+  /// Next job id
+  std::atomic<std::uint64_t> next_id_ = 1;
+  /// Protects rings_
+  mutable std::mutex rings_mutex_;
+  /// All rings; kept after their threads exit, so that their events may still be written out
+  std::vector<std::shared_ptr<trace_ring>> rings_;
+};
+
+/**
+ * @brief Records an event of \c type on the calling thread
+ */
+inline void trace_record(const trace_event_type type, const std::uint64_t id = 0, const char* const label = "")
+{
+  trace_registry::instance().record(type, id, label);
+}
+
+/**
+ * @brief Records enqueueing of a job named \c label on the calling thread, and returns its new id
+ */
+inline std::uint64_t trace_enqueue(const char* const label)
+{
+  auto& registry = trace_registry::instance();
+  const std::uint64_t id = registry.next_id();
+  registry.record(trace_event_type::enqueue, id, label);
+  return id;
+}
+
+/**
+ * @brief Writes \c str to \c os as a JSON string
+ */
+inline void write_json_string(std::ostream& os, const char* str)
+{
+  static constexpr char hex[] = "0123456789abcdef";
+  os << '"';
+  for (; *str != '\0'; ++str)
+  {
+    const auto c = static_cast<unsigned char>(*str);
+    if (c == '"' or c == '\\')
+    {
+      os << '\\' << *str;
+    }
+    else if (c < 0x20)
+    {
+      os << "\\u00" << hex[c >> 4] << hex[c & 0xF];
+    }
+    else
+    {
+      os << *str;
+    }
+  }
+  os << '"';
+}
+
+}  // namespace detail
+
+/**
+ * @brief Writes all recorded trace events to \c os as Chrome trace-event JSON (viewable in Perfetto or
+ *        <code>about:tracing</code>)
+ *
+ * Each job is a slice on the thread which ran it, linked by a flow arrow to the point it was enqueued; time spent
+ * enqueueing (including waiting on queue locks) and time workers spend idle are shown as \c "emplace" and \c "idle"
+ * slices. Events may be written while pools keep running.
+ */
+inline void write_trace(std::ostream& os)
+{
+  os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  bool first = true;
+  const auto begin_event = [&os, &first](const char* const label, const char* const phase, const std::size_t tid) {
+    os << (first ? "\n" : ",\n") << "{\"name\":";
+    detail::write_json_string(os, label);
+    os << ",\"cat\":\"parachute\",\"ph\":\"" << phase << "\",\"pid\":1,\"tid\":" << tid;
+    first = false;
+  };
+  const auto write_ts = [&os](const std::uint64_t timestamp_ns) {
+    os << ",\"ts\":" << (timestamp_ns / 1000) << '.';
+    const auto fraction = timestamp_ns % 1000;
+    os << static_cast<char>('0' + fraction / 100) << static_cast<char>('0' + (fraction / 10) % 10)
+       << static_cast<char>('0' + fraction % 10);
+  };
+
+  detail::trace_registry::instance().for_each_ring([&](const detail::trace_ring& ring) {
+    const std::size_t tid = ring.thread_index();
+    begin_event("thread_name", "M", tid);
+    os << ",\"args\":{\"name\":\"thread " << tid << "\"}}";
+
+    ring.for_each([&](const detail::trace_event& event) {
+      switch (event.type)
+      {
+      case detail::trace_event_type::emplace_begin:
+        begin_event("emplace", "B", tid);
+        write_ts(event.timestamp_ns);
+        os << '}';
+        break;
+      case detail::trace_event_type::emplace_end:
+        begin_event("emplace", "E", tid);
+        write_ts(event.timestamp_ns);
+        os << '}';
+        break;
+      case detail::trace_event_type::enqueue:
+        begin_event(event.label, "s", tid);
+        write_ts(event.timestamp_ns);
+        os << ",\"id\":" << event.id << '}';
+        break;
+      case detail::trace_event_type::start:
+        begin_event(event.label, "f", tid);
+        write_ts(event.timestamp_ns);
+        os << ",\"id\":" << event.id << ",\"bp\":\"e\"}";
+        begin_event(event.label, "B", tid);
+        write_ts(event.timestamp_ns);
+        os << ",\"args\":{\"id\":" << event.id << "}}";
+        break;
+      case detail::trace_event_type::end:
+        begin_event(event.label, "E", tid);
+        write_ts(event.timestamp_ns);
+        os << '}';
+        break;
+      case detail::trace_event_type::idle_begin:
+        begin_event("idle", "B", tid);
+        write_ts(event.timestamp_ns);
+        os << '}';
+        break;
+      case detail::trace_event_type::idle_end:
+        begin_event("idle", "E", tid);
+        write_ts(event.timestamp_ns);
+        os << '}';
+        break;
+      }
+    });
+  });
+  os << "\n]}\n";
+}
+
+/**
+ * @brief Writes all recorded trace events to the file at \c path as Chrome trace-event JSON
+ *
+ * @return true if the file was written
+ *
+ * @see write_trace
+ */
+inline bool dump_trace(const std::string& path)
+{
+  std::ofstream ofs{ path };
+  if (!ofs)
+  {
+    return false;
+  }
+  write_trace(ofs);
+  return static_cast<bool>(ofs);
+}
+
+}  // namespace para
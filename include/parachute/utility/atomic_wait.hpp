@@ -0,0 +1,202 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file atomic_wait.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+// Linux
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // defined(__linux__)
+
+namespace para::utility
+{
+
+/**
+ * @brief 32-bit atomic word which threads may park on until its value changes
+ */
+using atomic_wait_word = std::atomic<std::uint32_t>;
+
+namespace detail
+{
+
+/**
+ * @brief Number of times a waiter re-checks a word before parking
+ */
+inline constexpr std::size_t atomic_wait_spin_count = 64;
+
+/**
+ * @brief Spins briefly while \c word holds \c old
+ *
+ * @return true if \c word changed while spinning
+ */
+inline bool atomic_wait_spin(const atomic_wait_word& word, const std::uint32_t old)
+{
+  for (std::size_t i = 0; i < atomic_wait_spin_count; ++i)
+  {
+    if (word.load(std::memory_order_acquire) != old)
+    {
+      return true;
+    }
+    else if (i >= atomic_wait_spin_count / 2)
+    {
+      std::this_thread::yield();
+    }
+  }
+  return false;
+}
+
+#if defined(__linux__)
+
+static_assert(sizeof(atomic_wait_word) == sizeof(std::uint32_t), "futex words must be 32 bits wide");
+static_assert(atomic_wait_word::is_always_lock_free, "futex words must be lock-free");
+
+/**
+ * @brief Parks the calling thread while \c word holds \c old, for at most \c timeout (if not null)
+ */
+inline void park(const atomic_wait_word& word, const std::uint32_t old, const ::timespec* const timeout)
+{
+  ::syscall(SYS_futex, static_cast<const void*>(&word), FUTEX_WAIT_PRIVATE, old, timeout, nullptr, 0);
+}
+
+/**
+ * @brief Wakes all threads parked on \c word
+ */
+inline void unpark_all(const atomic_wait_word& word)
+{
+  ::syscall(SYS_futex, static_cast<const void*>(&word), FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+}
+
+#else
+
+/**
+ * @brief Mutex and condition variable shared by all words which hash to the same bucket
+ */
+struct parking_bucket
+{
+  std::mutex mutex;
+  std::condition_variable cv;
+};
+
+/**
+ * @brief Returns parking bucket used for \c word
+ */
+inline parking_bucket& bucket_of(const atomic_wait_word& word)
+{
+  static parking_bucket buckets[64];
+  return buckets[std::hash<const void*>{}(&word) % 64];
+}
+
+#endif  // defined(__linux__)
+
+}  // namespace detail
+
+/**
+ * @brief Blocks until \c word no longer holds \c old, or until \c deadline passes
+ *
+ * Spins briefly, then parks on a futex (on Linux), or on a condition variable shared with other words (elsewhere).
+ * Wake-ups must be signaled with <code>atomic_notify_all</code> after \c word is modified.
+ *
+ * @return true if \c word no longer holds \c old
+ */
+template <typename ClockT, typename DurationT>
+bool atomic_wait_until(
+  const atomic_wait_word& word,
+  const std::uint32_t old,
+  const std::chrono::time_point<ClockT, DurationT>& deadline)
+{
+  if (detail::atomic_wait_spin(word, old))
+  {
+    return true;
+  }
+
+#if defined(__linux__)
+  while (word.load(std::memory_order_acquire) == old)
+  {
+    const auto remaining = deadline - ClockT::now();
+    if (remaining <= DurationT::zero())
+    {
+      return false;
+    }
+    const auto remaining_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+    const ::timespec timeout{ static_cast<std::time_t>(remaining_ns / 1'000'000'000),
+                              static_cast<long>(remaining_ns % 1'000'000'000) };
+    detail::park(word, old, &timeout);
+  }
+  return true;
+#else
+  auto& bucket = detail::bucket_of(word);
+  std::unique_lock lock{ bucket.mutex };
+  return bucket.cv.wait_until(lock, deadline, [&word, old] { return word.load(std::memory_order_acquire) != old; });
+#endif  // defined(__linux__)
+}
+
+/**
+ * @brief Blocks until \c word no longer holds \c old, or until \c timeout elapses
+ *
+ * @return true if \c word no longer holds \c old
+ */
+template <typename RepT, typename PeriodT>
+bool atomic_wait_for(
+  const atomic_wait_word& word,
+  const std::uint32_t old,
+  const std::chrono::duration<RepT, PeriodT>& timeout)
+{
+  return atomic_wait_until(word, old, std::chrono::steady_clock::now() + timeout);
+}
+
+/**
+ * @brief Blocks until \c word no longer holds \c old
+ */
+inline void atomic_wait(const atomic_wait_word& word, const std::uint32_t old)
+{
+  if (detail::atomic_wait_spin(word, old))
+  {
+    return;
+  }
+
+#if defined(__linux__)
+  while (word.load(std::memory_order_acquire) == old)
+  {
+    detail::park(word, old, nullptr);
+  }
+#else
+  auto& bucket = detail::bucket_of(word);
+  std::unique_lock lock{ bucket.mutex };
+  bucket.cv.wait(lock, [&word, old] { return word.load(std::memory_order_acquire) != old; });
+#endif  // defined(__linux__)
+}
+
+/**
+ * @brief Wakes all threads blocked on \c word in <code>atomic_wait</code>, <code>atomic_wait_for</code> or
+ *        <code>atomic_wait_until</code>
+ */
+inline void atomic_notify_all(const atomic_wait_word& word)
+{
+#if defined(__linux__)
+  detail::unpark_all(word);
+#else
+  auto& bucket = detail::bucket_of(word);
+  {
+    // Waiters check word while holding the bucket lock, so taking it here orders this wake-up after their check
+    std::lock_guard lock{ bucket.mutex };
+  }
+  bucket.cv.notify_all();
+#endif  // defined(__linux__)
+}
+
+}  // namespace para::utility
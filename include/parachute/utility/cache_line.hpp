@@ -0,0 +1,21 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file cache_line.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+
+namespace para::utility
+{
+
+/**
+ * @brief Assumed size of a cache line, in bytes
+ *
+ * @note used in place of <code>std::hardware_destructive_interference_size</code>, which is not ABI stable
+ */
+inline constexpr std::size_t cache_line_size = 64;
+
+}  // namespace para::utility
@@ -6,50 +6,104 @@
 #pragma once
 
 // C++ Standard Library
-#include <condition_variable>
-#include <mutex>
-#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Parachute
+#include <parachute/idle_policy.hpp>
+#include <parachute/utility/atomic_wait.hpp>
 
 namespace para::utility
 {
 
 /**
  * @brief Waits until a count reaches zero
+ *
+ * Decrements are a single atomic subtraction; only the decrement which reaches zero wakes waiters, which park on a
+ * futex (see <code>atomic_wait</code>) rather than on a mutex and condition variable
+ *
+ * @note the last decrement wakes waiters after releasing them, using only the address of the countdown, so a waiter
+ *       may destroy the countdown as soon as <code>wait()</code> returns
  */
 class countdown
 {
 public:
-  explicit countdown(std::size_t n) : count_{ n } {}
+  explicit countdown(std::size_t n) : count_{ n }, released_{ (n == 0) ? released : waiting } {}
 
   countdown& operator--()
   {
-    return decrement([] {});
+    if (count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+      released_.store(released, std::memory_order_release);
+      atomic_notify_all(released_);
+    }
+    return *this;
   }
 
+  /**
+   * @brief Calls \c f, then decrements; effects of \c f are visible to waiters once they are released
+   */
   template <typename FnT> countdown& decrement(FnT f)
   {
-    std::lock_guard lock{ count_mutex_ };
     f();
-    --count_;
-    count_cv_.notify_one();
-    return *this;
+    return --(*this);
   }
 
-  void wait()
+  /**
+   * @brief Waits until count reaches zero
+   *
+   * Polls according to \c IdlePolicyT (e.g. <code>idle_spin</code>) before parking; with <code>idle_park</code>, parks
+   * after a brief spin
+   */
+  template <typename IdlePolicyT = idle_park> void wait()
   {
-    std::unique_lock lock{ count_mutex_ };
-    if (count_)
+    if (::para::detail::idle_poll<IdlePolicyT>([this] { return is_released(); }))
+    {
+      return;
+    }
+    while (!is_released())
     {
-      count_cv_.wait(lock, [this] { return count_ == 0; });
+      atomic_wait(released_, waiting);
     }
   }
 
-  constexpr bool valid() const { return count_ > 0; }
+  /**
+   * @brief Waits until count reaches zero, calling \c help while it waits
+   *
+   * \c help returns true if it did some work (e.g. <code>pool_base::try_run_one</code>), after which the count is
+   * checked again; otherwise, waits for the count to reach zero, for at most \c help_interval, before calling \c help
+   * again
+   */
+  template <typename HelpFnT> void wait(HelpFnT&& help)
+  {
+    while (!is_released())
+    {
+      if (!help())
+      {
+        atomic_wait_for(released_, waiting, help_interval);
+      }
+    }
+  }
+
+  /// Longest time <code>wait(help)</code> blocks between calls to \c help
+  static constexpr std::chrono::microseconds help_interval{ 100 };
+
+  bool valid() const { return count_.load(std::memory_order_relaxed) > 0; }
 
 private:
-  std::size_t count_;
-  std::mutex count_mutex_;
-  std::condition_variable count_cv_;
+  /// Values of released_
+  static constexpr std::uint32_t waiting = 0;
+  static constexpr std::uint32_t released = 1;
+
+  /// Returns true if count has reached zero
+  bool is_released() const { return released_.load(std::memory_order_acquire) == released; }
+
+  /// Remaining decrements
+  std::atomic<std::size_t> count_;
+  /// Word which waiters park on; set to released by the decrement which reaches zero
+  atomic_wait_word released_;
 };
 
-}  // namespace para::utility
\ No newline at end of file
+}  // namespace para::utility
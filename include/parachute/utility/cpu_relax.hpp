@@ -0,0 +1,31 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file cpu_relax.hpp
+ */
+#pragma once
+
+#if defined(__x86_64__) or defined(__i386__) or defined(_M_X64) or defined(_M_IX86)
+// x86
+#include <immintrin.h>
+#endif
+
+namespace para::utility
+{
+
+/**
+ * @brief Hints to the CPU that the calling thread is in a spin-wait loop
+ *
+ * Issues <code>pause</code> on x86 and <code>yield</code> on ARM, which lowers power use while spinning and frees
+ * execution resources for an SMT sibling; does nothing on other targets
+ */
+inline void cpu_relax()
+{
+#if defined(__x86_64__) or defined(__i386__) or defined(_M_X64) or defined(_M_IX86)
+  _mm_pause();
+#elif defined(__aarch64__) or defined(__arm__)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
+}  // namespace para::utility
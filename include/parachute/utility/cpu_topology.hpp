@@ -0,0 +1,163 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file cpu_topology.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace para::utility
+{
+
+/**
+ * @brief Location of one logical CPU (hardware thread) within the machine
+ */
+struct cpu_info
+{
+  /// Logical CPU number, as used by the OS scheduler
+  unsigned cpu = 0;
+  /// Physical core which runs this CPU; CPUs on the same core are SMT siblings
+  unsigned core = 0;
+  /// Physical package (socket) which holds the core
+  unsigned package = 0;
+  /// NUMA node closest to this CPU
+  unsigned numa_node = 0;
+};
+
+/**
+ * @brief Parses a CPU list, such as <code>"0-3,8,10-11"</code>, as found in sysfs
+ *
+ * @return listed CPU numbers, in the order listed; empty if \c list is malformed
+ */
+inline std::vector<unsigned> parse_cpu_list(const std::string& list)
+{
+  std::vector<unsigned> cpus;
+  std::istringstream is{ list };
+  std::string range;
+  while (std::getline(is, range, ','))
+  {
+    if (range.empty())
+    {
+      continue;
+    }
+
+    unsigned first = 0;
+    unsigned last = 0;
+    char dash = '\0';
+    std::istringstream range_is{ range };
+    if (!(range_is >> first))
+    {
+      return {};
+    }
+    else if (range_is >> dash)
+    {
+      if (dash != '-' or !(range_is >> last) or last < first)
+      {
+        return {};
+      }
+    }
+    else
+    {
+      last = first;
+    }
+
+    for (unsigned cpu = first; cpu <= last; ++cpu)
+    {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+namespace detail
+{
+
+/// Reads the first line of the file at \c path into \c line; returns false if it can't be read
+inline bool read_first_line(const std::string& path, std::string& line)
+{
+  std::ifstream ifs{ path };
+  return static_cast<bool>(std::getline(ifs, line));
+}
+
+/// Reads the unsigned integer held by the file at \c path into \c value; returns false if it can't be read
+inline bool read_unsigned(const std::string& path, unsigned& value)
+{
+  std::ifstream ifs{ path };
+  return static_cast<bool>(ifs >> value);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Reads the topology of all online CPUs from sysfs
+ *
+ * Reads <code>cpu/online</code>, <code>cpu/cpuN/topology/{core_id,physical_package_id}</code> and
+ * <code>node/nodeM/cpulist</code> under \c sysfs_root. Missing per-CPU entries default to 0. If the list of online
+ * CPUs can't be read (e.g. on systems without sysfs), each of <code>std::thread::hardware_concurrency()</code> CPUs
+ * is reported on its own core, in package 0 and NUMA node 0.
+ *
+ * @param sysfs_root  directory holding the <code>cpu</code> and <code>node</code> sysfs trees
+ *
+ * @return one entry per online CPU, ordered by CPU number
+ */
+inline std::vector<cpu_info> read_cpu_topology(const std::string& sysfs_root = "/sys/devices/system")
+{
+  std::vector<cpu_info> topology;
+
+  std::string online;
+  if (!detail::read_first_line(sysfs_root + "/cpu/online", online) or parse_cpu_list(online).empty())
+  {
+    const unsigned n = std::max(1U, std::thread::hardware_concurrency());
+    for (unsigned cpu = 0; cpu < n; ++cpu)
+    {
+      topology.push_back(cpu_info{ cpu, cpu, 0, 0 });
+    }
+    return topology;
+  }
+
+  for (const unsigned cpu : parse_cpu_list(online))
+  {
+    const std::string cpu_dir = sysfs_root + "/cpu/cpu" + std::to_string(cpu) + "/topology/";
+    cpu_info info{ cpu, cpu, 0, 0 };
+    detail::read_unsigned(cpu_dir + "core_id", info.core);
+    detail::read_unsigned(cpu_dir + "physical_package_id", info.package);
+    topology.push_back(info);
+  }
+
+  std::string nodes;
+  if (detail::read_first_line(sysfs_root + "/node/online", nodes))
+  {
+    for (const unsigned node : parse_cpu_list(nodes))
+    {
+      std::string node_cpus;
+      if (!detail::read_first_line(sysfs_root + "/node/node" + std::to_string(node) + "/cpulist", node_cpus))
+      {
+        continue;
+      }
+      for (const unsigned cpu : parse_cpu_list(node_cpus))
+      {
+        for (auto& info : topology)
+        {
+          if (info.cpu == cpu)
+          {
+            info.numa_node = node;
+          }
+        }
+      }
+    }
+  }
+
+  std::sort(
+    topology.begin(), topology.end(), [](const cpu_info& lhs, const cpu_info& rhs) { return lhs.cpu < rhs.cpu; });
+  return topology;
+}
+
+}  // namespace para::utility
@@ -0,0 +1,205 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file slab.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+
+namespace para::utility
+{
+
+/**
+ * @brief Recycles fixed-size memory blocks through thread-local free lists
+ *
+ * Freed blocks go to a free list owned by the freeing thread, and are handed out again by that thread without taking
+ * a lock. A thread whose list grows past \c CacheBlocksV blocks moves half of them to a shared depot; a thread whose
+ * list is empty refills from the depot, and only calls <code>::operator new</code> if the depot is empty too. Blocks
+ * are therefore recycled even when they are allocated on one thread and freed on another.
+ *
+ * Blocks are never returned to the system, so the memory held is bounded by the peak number of blocks in use at once.
+ * The depot is never destroyed, so that threads which exit during static destruction (e.g. those of a static pool)
+ * may still give it their blocks.
+ *
+ * @tparam BlockBytesV  size of each block, in bytes
+ * @tparam BlockAlignV  alignment of each block
+ * @tparam CacheBlocksV  maximum number of free blocks held by each thread
+ */
+template <std::size_t BlockBytesV, std::size_t BlockAlignV, std::size_t CacheBlocksV = 64> class slab
+{
+  static_assert(CacheBlocksV >= 2, "slab<B, A, N> must cache (N >= 2) blocks per thread");
+
+public:
+  /**
+   * @brief Returns a block of at least \c BlockBytesV bytes, aligned to \c BlockAlignV
+   */
+  static void* allocate()
+  {
+    auto& list = local();
+    if (list.head == nullptr)
+    {
+      depot().take(list);
+      if (list.head == nullptr)
+      {
+        return ::operator new(block_bytes, std::align_val_t{ block_align });
+      }
+    }
+    return list.pop();
+  }
+
+  /**
+   * @brief Returns a block from <code>allocate</code> to the calling thread's free list
+   */
+  static void deallocate(void* const ptr) noexcept
+  {
+    auto& list = local();
+    list.push(ptr);
+    if (list.size > CacheBlocksV)
+    {
+      depot().give(list, CacheBlocksV / 2);
+    }
+  }
+
+private:
+  /// Size of each block, large enough to hold a free list link
+  static constexpr std::size_t block_bytes = (BlockBytesV < sizeof(void*)) ? sizeof(void*) : BlockBytesV;
+
+  /// Alignment of each block, large enough to hold a free list link
+  static constexpr std::size_t block_align = (BlockAlignV < alignof(void*)) ? alignof(void*) : BlockAlignV;
+
+  /**
+   * @brief Free block; its storage holds the link to the next free block
+   */
+  struct free_block
+  {
+    free_block* next;
+  };
+
+  /**
+   * @brief Singly-linked list of free blocks
+   */
+  struct free_list
+  {
+    /// First free block
+    free_block* head = nullptr;
+    /// Number of free blocks
+    std::size_t size = 0;
+
+    void push(void* const ptr) noexcept
+    {
+      head = new (ptr) free_block{ head };
+      ++size;
+    }
+
+    void* pop() noexcept
+    {
+      free_block* const block = head;
+      head = block->next;
+      --size;
+      return block;
+    }
+  };
+
+  /**
+   * @brief Free blocks shared between threads
+   */
+  struct shared_depot
+  {
+    /// Moves up to \c CacheBlocksV / 2 blocks to \c list
+    void take(free_list& list) noexcept
+    {
+      std::lock_guard lock{ mutex };
+      for (std::size_t n = 0; n < CacheBlocksV / 2 and blocks.head != nullptr; ++n)
+      {
+        list.push(blocks.pop());
+      }
+    }
+
+    /// Moves \c n blocks from \c list
+    void give(free_list& list, std::size_t n) noexcept
+    {
+      std::lock_guard lock{ mutex };
+      for (; n > 0 and list.head != nullptr; --n)
+      {
+        blocks.push(list.pop());
+      }
+    }
+
+    /// Protects blocks
+    std::mutex mutex;
+    /// Free blocks
+    free_list blocks;
+  };
+
+  /**
+   * @brief Free blocks owned by one thread; given to the depot when the thread exits
+   */
+  struct thread_cache : free_list
+  {
+    ~thread_cache() { depot().give(*this, this->size); }
+  };
+
+  /// Returns depot shared by all threads; leaked, so that it outlives every thread cache, including those destroyed
+  /// after static destruction has begun
+  static shared_depot& depot()
+  {
+    static shared_depot* const instance = new shared_depot;
+    return *instance;
+  }
+
+  /// Returns free list owned by the calling thread
+  static free_list& local()
+  {
+    static thread_local thread_cache list;
+    return list;
+  }
+};
+
+/**
+ * @brief Standard allocator which takes single-object allocations from a <code>slab</code>
+ *
+ * Array allocations are passed to <code>std::allocator</code>
+ *
+ * @tparam T  allocated type
+ */
+template <typename T> class slab_allocator
+{
+public:
+  using value_type = T;
+
+  slab_allocator() = default;
+
+  template <typename U> constexpr slab_allocator(const slab_allocator<U>&) noexcept {}
+
+  [[nodiscard]] T* allocate(const std::size_t n)
+  {
+    if (n == 1)
+    {
+      return static_cast<T*>(slab<sizeof(T), alignof(T)>::allocate());
+    }
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* const ptr, const std::size_t n) noexcept
+  {
+    if (n == 1)
+    {
+      slab<sizeof(T), alignof(T)>::deallocate(ptr);
+    }
+    else
+    {
+      std::allocator<T>{}.deallocate(ptr, n);
+    }
+  }
+
+  template <typename U> constexpr bool operator==(const slab_allocator<U>&) const noexcept { return true; }
+
+  template <typename U> constexpr bool operator!=(const slab_allocator<U>&) const noexcept { return false; }
+};
+
+}  // namespace para::utility
@@ -0,0 +1,285 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file timer_wheel.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace para::utility
+{
+
+/**
+ * @brief Intrusive link of an entry in a <code>timer_wheel</code>; entries derive from it
+ */
+struct timer_wheel_node
+{
+  /// Previous node in slot list; null if not in a wheel
+  timer_wheel_node* prev = nullptr;
+  /// Next node in slot list; null if not in a wheel
+  timer_wheel_node* next = nullptr;
+  /// Tick at which this node expires
+  std::uint64_t expiry = 0;
+  /// Level of the slot which holds this node
+  std::size_t level = 0;
+
+  /**
+   * @brief Returns true if this node is in a wheel
+   */
+  constexpr bool linked() const { return prev != nullptr; }
+};
+
+/**
+ * @brief Hierarchical timer wheel: nodes which expire at some tick, bucketed by how far off that tick is
+ *
+ * Level 0 has one slot per tick for the next <code>slot_count</code> ticks; each higher level has slots which each
+ * span a whole rotation of the level below, and are cascaded (re-bucketed) into lower levels as time reaches them.
+ * Nodes further off than all levels span wait in the last level, and are re-bucketed each time it is cascaded.
+ *
+ * Insertion and removal are O(1); advancing costs O(1) per tick with work due, plus cascading.
+ *
+ * Not thread-safe; nodes are not owned, and must outlive their time in the wheel.
+ *
+ * @tparam LevelsV  number of levels
+ * @tparam SlotBitsV  log2 of number of slots per level
+ */
+template <std::size_t LevelsV = 4, std::size_t SlotBitsV = 6> class timer_wheel
+{
+  static_assert(LevelsV > 0, "timer_wheel must have at least one level");
+  static_assert(LevelsV * SlotBitsV < 64, "timer_wheel levels must span fewer than 2^64 ticks");
+
+public:
+  /// Number of levels
+  static constexpr std::size_t levels = LevelsV;
+
+  /// Number of slots per level
+  static constexpr std::size_t slot_count = std::size_t{ 1 } << SlotBitsV;
+
+  /// Number of ticks ahead of now which levels span
+  static constexpr std::uint64_t span = std::uint64_t{ 1 } << (LevelsV * SlotBitsV);
+
+  /**
+   * @brief Creates an empty wheel, at tick \c now
+   */
+  explicit timer_wheel(const std::uint64_t now = 0) : now_{ now }
+  {
+    for (auto& level : slots_)
+    {
+      for (auto& head : level)
+      {
+        head.prev = &head;
+        head.next = &head;
+      }
+    }
+  }
+
+  // Slot lists point at their heads, which are stored inline
+  timer_wheel(const timer_wheel&) = delete;
+  timer_wheel& operator=(const timer_wheel&) = delete;
+
+  /**
+   * @brief Returns current tick
+   */
+  constexpr std::uint64_t now() const { return now_; }
+
+  /**
+   * @brief Returns number of nodes in the wheel
+   */
+  constexpr std::size_t size() const { return size_; }
+
+  /**
+   * @brief Returns true if there are no nodes in the wheel
+   */
+  constexpr bool empty() const { return size_ == 0; }
+
+  /**
+   * @brief Adds \c node, to expire at tick \c expiry; a node due now, or earlier, expires on the next tick
+   *
+   * @warning behavior is undefined if \c node is already in a wheel
+   */
+  void insert(timer_wheel_node& node, const std::uint64_t expiry)
+  {
+    node.expiry = (expiry > now_) ? expiry : (now_ + 1);
+    place(node);
+    ++size_;
+  }
+
+  /**
+   * @brief Removes \c node, which must be in this wheel
+   */
+  void erase(timer_wheel_node& node)
+  {
+    unlink(node);
+    --size_;
+  }
+
+  /**
+   * @brief Advances current tick to \c to, calling <code>expire(node)</code> on each node which expires on the way
+   *
+   * Nodes are removed before \c expire is called on them, so \c expire may re-insert them (or destroy them)
+   */
+  template <typename ExpireFnT> void advance(const std::uint64_t to, ExpireFnT&& expire)
+  {
+    while (now_ < to)
+    {
+      // Skip ticks at which there is nothing to cascade or expire
+      const auto next = next_tick();
+      if (!next or *next > to)
+      {
+        now_ = to;
+        return;
+      }
+      now_ = *next;
+
+      // Re-bucket higher level slots which now fall within range of the levels below
+      for (std::size_t level = 1; level < levels and (now_ & low_mask(level)) == 0; ++level)
+      {
+        timer_wheel_node cascaded;
+        take(level, slot_index(level, now_), cascaded);
+        while (cascaded.next != &cascaded)
+        {
+          auto& node = *cascaded.next;
+          unlink(node);
+          place(node);
+        }
+      }
+
+      // Expire all nodes due now
+      timer_wheel_node expired;
+      take(0, slot_index(0, now_), expired);
+      while (expired.next != &expired)
+      {
+        auto& node = *expired.next;
+        unlink(node);
+        --size_;
+        expire(node);
+      }
+    }
+  }
+
+  /**
+   * @brief Removes all nodes, calling <code>f(node)</code> on each after it is removed
+   */
+  template <typename FnT> void clear(FnT&& f)
+  {
+    for (std::size_t level = 0; level < levels; ++level)
+    {
+      for (auto& head : slots_[level])
+      {
+        while (head.next != &head)
+        {
+          auto& node = *head.next;
+          erase(node);
+          f(node);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Returns earliest tick at which advancing would expire or cascade nodes, or nothing if the wheel is empty
+   */
+  std::optional<std::uint64_t> next_tick() const
+  {
+    if (size_ == 0)
+    {
+      return std::nullopt;
+    }
+    const bool higher_levels_empty = (size_ == level_size_[0]);
+    for (std::uint64_t tick = now_ + 1;; ++tick)
+    {
+      if ((tick & low_mask(1)) == 0 and !higher_levels_empty)
+      {
+        return tick;
+      }
+      if (const auto& head = slots_[0][slot_index(0, tick)]; head.next != &head)
+      {
+        return tick;
+      }
+    }
+  }
+
+private:
+  /// Returns mask of tick bits below those which index \c level
+  static constexpr std::uint64_t low_mask(const std::size_t level)
+  {
+    return (std::uint64_t{ 1 } << (level * SlotBitsV)) - 1;
+  }
+
+  /// Returns slot of \c level which \c tick falls in
+  static constexpr std::size_t slot_index(const std::size_t level, const std::uint64_t tick)
+  {
+    return static_cast<std::size_t>((tick >> (level * SlotBitsV)) & (slot_count - 1));
+  }
+
+  /// Links \c node into the slot its expiry falls in, relative to now
+  void place(timer_wheel_node& node)
+  {
+    const std::uint64_t delta = node.expiry - now_;
+    std::size_t level = 0;
+    while (level + 1 < levels and delta > low_mask(level + 1))
+    {
+      ++level;
+    }
+    // Nodes beyond the span of all levels wait in the furthest slot, until re-bucketed
+    const std::uint64_t tick = (delta < span) ? node.expiry : (now_ + span - 1);
+    link(level, slot_index(level, tick), node);
+  }
+
+  /// Links \c node at the back of slot \c index of \c level
+  void link(const std::size_t level, const std::size_t index, timer_wheel_node& node)
+  {
+    auto& head = slots_[level][index];
+    node.prev = head.prev;
+    node.next = &head;
+    head.prev->next = &node;
+    head.prev = &node;
+    node.level = level;
+    ++level_size_[level];
+  }
+
+  /// Unlinks \c node from its slot
+  void unlink(timer_wheel_node& node)
+  {
+    --level_size_[node.level];
+    node.prev->next = node.next;
+    node.next->prev = node.prev;
+    node.prev = nullptr;
+    node.next = nullptr;
+  }
+
+  /// Moves all nodes in slot \c index of \c level to the list headed by \c list; they still count towards \c level
+  /// until unlinked
+  void take(const std::size_t level, const std::size_t index, timer_wheel_node& list)
+  {
+    auto& head = slots_[level][index];
+    if (head.next == &head)
+    {
+      list.prev = &list;
+      list.next = &list;
+      return;
+    }
+    list.next = head.next;
+    list.prev = head.prev;
+    list.next->prev = &list;
+    list.prev->next = &list;
+    head.prev = &head;
+    head.next = &head;
+  }
+
+  /// Current tick
+  std::uint64_t now_;
+  /// Number of nodes in the wheel
+  std::size_t size_ = 0;
+  /// Number of nodes in each level
+  std::array<std::size_t, levels> level_size_ = {};
+  /// Slot list heads, per level
+  std::array<std::array<timer_wheel_node, slot_count>, levels> slots_;
+};
+
+}  // namespace para::utility
@@ -0,0 +1,184 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file work_stealing_deque.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// Parachute
+#include <parachute/utility/cache_line.hpp>
+
+namespace para::utility
+{
+
+/**
+ * @brief Chase-Lev work-stealing deque
+ *
+ * The owning thread pushes and pops at the bottom of the deque; any other thread may steal from the top. Storage
+ * grows as needed. Buffers replaced while growing are retired, but not released, until the deque is destroyed, since
+ * thieves may still be reading from them.
+ *
+ * @tparam T  held value type; must be trivially copyable (typically a pointer)
+ *
+ * @see "Correct and Efficient Work-Stealing for Weak Memory Models", Le et al., PPoPP 2013
+ */
+template <typename T> class work_stealing_deque
+{
+  static_assert(std::is_trivially_copyable_v<T>, "work_stealing_deque<T> requires trivially copyable T");
+
+public:
+  /**
+   * @brief Initializes an empty deque
+   *
+   * @param capacity  initial capacity; rounded up to the next power of two
+   */
+  explicit work_stealing_deque(std::size_t capacity = 64) : top_{ 0 }, bottom_{ 0 }
+  {
+    std::size_t rounded_capacity = 1;
+    while (rounded_capacity < capacity)
+    {
+      rounded_capacity <<= 1;
+    }
+    retired_.emplace_back(std::make_unique<ring>(rounded_capacity));
+    ring_.store(retired_.back().get(), std::memory_order_relaxed);
+  }
+
+  work_stealing_deque(const work_stealing_deque&) = delete;
+
+  /**
+   * @brief Adds \c value to the bottom of the deque
+   * @warning may only be called by the owning thread
+   */
+  void push(T value)
+  {
+    const std::int64_t b = bottom_.load(std::memory_order_relaxed);
+    const std::int64_t t = top_.load(std::memory_order_acquire);
+    ring* r = ring_.load(std::memory_order_relaxed);
+    if (b - t > r->capacity() - 1)
+    {
+      r = grow(r, b, t);
+    }
+    r->put(b, value);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Removes a value from the bottom of the deque
+   * @warning may only be called by the owning thread
+   *
+   * @return true if \c value was assigned
+   */
+  [[nodiscard]] bool pop(T& value)
+  {
+    const std::int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    ring* const r = ring_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t t = top_.load(std::memory_order_relaxed);
+
+    if (t > b)
+    {
+      // Deque was empty
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return false;
+    }
+
+    value = r->get(b);
+    if (t == b)
+    {
+      // Last element; race against thieves for it
+      const bool won = top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return won;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Removes a value from the top of the deque
+   *
+   * @return true if \c value was assigned; false if the deque was empty, or if another thread won the value
+   */
+  [[nodiscard]] bool steal(T& value)
+  {
+    std::int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const std::int64_t b = bottom_.load(std::memory_order_acquire);
+
+    if (t >= b)
+    {
+      return false;
+    }
+
+    ring* const r = ring_.load(std::memory_order_acquire);
+    value = r->get(t);
+    return top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Returns true if deque appears to hold no values
+   */
+  bool empty() const
+  {
+    const std::int64_t b = bottom_.load(std::memory_order_acquire);
+    const std::int64_t t = top_.load(std::memory_order_acquire);
+    return b <= t;
+  }
+
+private:
+  /**
+   * @brief Circular buffer of atomic slots
+   */
+  class ring
+  {
+  public:
+    explicit ring(std::size_t capacity) :
+        slots_{ std::make_unique<std::atomic<T>[]>(capacity) }, mask_{ static_cast<std::int64_t>(capacity) - 1 }
+    {}
+
+    constexpr std::int64_t capacity() const { return mask_ + 1; }
+
+    void put(std::int64_t i, T value) { slots_[i & mask_].store(value, std::memory_order_relaxed); }
+
+    T get(std::int64_t i) const { return slots_[i & mask_].load(std::memory_order_relaxed); }
+
+  private:
+    /// Value storage
+    std::unique_ptr<std::atomic<T>[]> slots_;
+    /// Maps a position to a slot index
+    std::int64_t mask_;
+  };
+
+  /// Replaces current ring with one twice its size
+  ring* grow(ring* const r, const std::int64_t b, const std::int64_t t)
+  {
+    retired_.emplace_back(std::make_unique<ring>(2 * static_cast<std::size_t>(r->capacity())));
+    ring* const next = retired_.back().get();
+    for (std::int64_t i = t; i < b; ++i)
+    {
+      next->put(i, r->get(i));
+    }
+    ring_.store(next, std::memory_order_release);
+    return next;
+  }
+
+  /// Position of next value to steal
+  alignas(cache_line_size) std::atomic<std::int64_t> top_;
+  /// Position one past the last pushed value
+  alignas(cache_line_size) std::atomic<std::int64_t> bottom_;
+  /// Active ring
+  alignas(cache_line_size) std::atomic<ring*> ring_;
+  /// All rings allocated by this deque, including the active one
+  std::vector<std::unique_ptr<ring>> retired_;
+};
+
+}  // namespace para::utility
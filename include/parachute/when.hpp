@@ -0,0 +1,483 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file when.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Parachute
+#include <parachute/non_blocking_future.hpp>
+
+namespace para
+{
+
+/**
+ * @brief Result of <code>when_any</code> over futures with a non-void value type
+ *
+ * @tparam T  held value type
+ */
+template <typename T> struct when_any_result
+{
+  /// Position of the first future to hold a result
+  std::size_t index;
+  /// Value held by that future
+  T value;
+};
+
+namespace detail
+{
+
+/**
+ * @brief Value type of a <code>non_blocking_future</code>; undefined for other types
+ */
+template <typename FutureT> struct future_value;
+
+/**
+ * @copydoc future_value
+ */
+template <typename T> struct future_value<non_blocking_future<T>>
+{
+  using type = T;
+};
+
+/**
+ * @brief Value type of futures visited by iterator type \c IteratorT
+ */
+template <typename IteratorT>
+using iterator_future_value_t = typename future_value<typename std::iterator_traits<IteratorT>::value_type>::type;
+
+/**
+ * @brief Storage for the value of one future passed to <code>when_all</code>; void values are not stored
+ */
+template <typename T> using when_all_slot_t = std::conditional_t<std::is_void_v<T>, std::tuple<>, std::optional<T>>;
+
+/**
+ * @brief Tuple of the non-void types in \c Ts
+ */
+template <typename... Ts>
+using when_all_tuple_t =
+  decltype(std::tuple_cat(std::declval<std::conditional_t<std::is_void_v<Ts>, std::tuple<>, std::tuple<Ts>>>()...));
+
+/**
+ * @brief Value type of the future returned by a variadic <code>when_all</code>; void if no value is held
+ */
+template <typename TupleT> struct when_all_result
+{
+  using type = TupleT;
+};
+
+/**
+ * @copydoc when_all_result
+ */
+template <> struct when_all_result<std::tuple<>>
+{
+  using type = void;
+};
+
+/**
+ * @brief Moves value out of a filled <code>when_all</code> slot, as a tuple of zero or one elements
+ */
+template <typename T> std::tuple<T> when_all_take(std::optional<T>& slot) { return std::tuple<T>{ std::move(*slot) }; }
+
+/**
+ * @copydoc when_all_take
+ */
+inline std::tuple<> when_all_take(std::tuple<>&) { return {}; }
+
+/**
+ * @brief Stores \c value in an empty <code>when_all</code> slot
+ */
+template <typename T, typename U> void when_all_store(std::optional<T>& slot, U&& value)
+{
+  slot.emplace(std::forward<U>(value));
+}
+
+/**
+ * @brief Slots for the values of futures passed to a variadic <code>when_all</code>
+ */
+template <typename... Ts> struct when_all_tuple_storage
+{
+  /// One slot per future
+  std::tuple<when_all_slot_t<Ts>...> slots;
+
+  /// Moves all stored values into the combined result
+  when_all_tuple_t<Ts...> take() { return take(std::index_sequence_for<Ts...>{}); }
+
+  template <std::size_t... Is> when_all_tuple_t<Ts...> take(std::index_sequence<Is...>)
+  {
+    return std::tuple_cat(when_all_take(std::get<Is>(slots))...);
+  }
+};
+
+/**
+ * @brief Slots for the values of a range of futures passed to <code>when_all</code>
+ */
+template <typename T> struct when_all_vector_storage
+{
+  /// One slot per future
+  std::vector<std::optional<T>> slots;
+
+  explicit when_all_vector_storage(const std::size_t count) : slots(count) {}
+
+  /// Moves all stored values into the combined result
+  std::vector<T> take()
+  {
+    std::vector<T> values;
+    values.reserve(slots.size());
+    for (auto& slot : slots)
+    {
+      values.emplace_back(std::move(*slot));
+    }
+    return values;
+  }
+};
+
+/**
+ * @brief Stores \c value in the empty slot at \c index
+ */
+template <typename T, typename U>
+void when_all_store(when_all_vector_storage<T>& storage, const std::size_t index, U&& value)
+{
+  when_all_store(storage.slots[index], std::forward<U>(value));
+}
+
+/**
+ * @copydoc when_all_vector_storage
+ * @note void specialization; no values are stored
+ */
+template <> struct when_all_vector_storage<void>
+{
+  explicit when_all_vector_storage(std::size_t) {}
+};
+
+/**
+ * @brief State shared by all futures passed to one <code>when_all</code>
+ *
+ * Each future stores its value (or its exception) when it becomes ready, then counts down. The future which counts
+ * down last sets the combined result, then destroys this state.
+ *
+ * @tparam ResultT  value type of the combined future
+ * @tparam StorageT  value slots; provides <code>ResultT take()</code> if \c ResultT is not void
+ */
+template <typename ResultT, typename StorageT> class when_all_state
+{
+public:
+  when_all_state(const std::size_t count, StorageT&& storage) : remaining_{ count }, storage_{ std::move(storage) } {}
+
+  /**
+   * @brief Returns future for the combined result
+   */
+  non_blocking_future<ResultT> get_future() { return promise_.get_future(); }
+
+  /**
+   * @brief Returns value slots
+   */
+  StorageT& storage() { return storage_; }
+
+  /**
+   * @brief Records \c ex, if no other exception was recorded first
+   */
+  void fail(std::exception_ptr&& ex)
+  {
+    if (!failed_.exchange(true, std::memory_order_relaxed))
+    {
+      error_ = std::move(ex);
+    }
+  }
+
+  /**
+   * @brief Counts down one ready future; sets combined result and destroys this state if it was the last one
+   */
+  void arrive()
+  {
+    // Release publishes this future's slot (or exception); acquire makes all slots visible to the last future
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    {
+      return;
+    }
+
+    try
+    {
+      if (error_ != nullptr)
+      {
+        promise_.set_exception(std::move(error_));
+      }
+      else if constexpr (std::is_void_v<ResultT>)
+      {
+        promise_.set_value();
+      }
+      else
+      {
+        promise_.set_value(storage_.take());
+      }
+    }
+    catch (...)
+    {
+      promise_.set_exception(std::current_exception());
+    }
+    delete this;
+  }
+
+private:
+  /// Number of futures which are not yet ready
+  std::atomic<std::size_t> remaining_;
+  /// Set once an exception is recorded
+  std::atomic<bool> failed_ = false;
+  /// First exception held by (or thrown while storing) a future's result
+  std::exception_ptr error_ = nullptr;
+  /// Value slots
+  StorageT storage_;
+  /// Combined result
+  non_blocking_promise<ResultT> promise_;
+};
+
+/**
+ * @brief Stores the result of \c future through \c store once it is ready, then counts it down on \c state
+ */
+template <typename StateT, typename T, typename StoreT>
+void when_all_watch(StateT* const state, non_blocking_future<T>&& future, StoreT store)
+{
+  on_ready(std::move(future), [state, store](non_blocking_future<T>&& ready) mutable {
+    try
+    {
+      if constexpr (std::is_void_v<T>)
+      {
+        ready.get();
+      }
+      else
+      {
+        store(ready.get());
+      }
+    }
+    catch (...)
+    {
+      state->fail(std::current_exception());
+    }
+    state->arrive();
+  });
+}
+
+/**
+ * @brief State shared by all futures passed to one <code>when_any</code>
+ *
+ * The first future to become ready sets the combined result. Every future counts down once it is ready; the last one
+ * destroys this state.
+ *
+ * @tparam T  value type of the futures
+ */
+template <typename T> class when_any_state
+{
+public:
+  /// Value type of the combined future
+  using result_type = std::conditional_t<std::is_void_v<T>, std::size_t, when_any_result<T>>;
+
+  explicit when_any_state(const std::size_t count) : remaining_{ count } {}
+
+  /**
+   * @brief Returns future for the combined result
+   */
+  non_blocking_future<result_type> get_future() { return promise_.get_future(); }
+
+  /**
+   * @brief Sets combined result from \c ready, if no other future was ready first; then counts it down
+   */
+  void arrive(const std::size_t index, non_blocking_future<T>&& ready)
+  {
+    if (!done_.exchange(true, std::memory_order_relaxed))
+    {
+      try
+      {
+        if constexpr (std::is_void_v<T>)
+        {
+          ready.get();
+          promise_.set_value(std::size_t{ index });
+        }
+        else
+        {
+          promise_.set_value(result_type{ index, ready.get() });
+        }
+      }
+      catch (...)
+      {
+        promise_.set_exception(std::current_exception());
+      }
+    }
+
+    // Acquire orders destruction after the combined result was set by whichever future was first
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+      delete this;
+    }
+  }
+
+private:
+  /// Number of futures which are not yet ready
+  std::atomic<std::size_t> remaining_;
+  /// Set by the first future to become ready
+  std::atomic<bool> done_ = false;
+  /// Combined result
+  non_blocking_promise<result_type> promise_;
+};
+
+/**
+ * @brief Counts down \c future on \c state once it is ready
+ */
+template <typename T>
+void when_any_watch(when_any_state<T>* const state, const std::size_t index, non_blocking_future<T>&& future)
+{
+  on_ready(std::move(future), [state, index](non_blocking_future<T>&& ready) {
+    state->arrive(index, std::move(ready));
+  });
+}
+
+/**
+ * @brief Variadic <code>when_all</code> over futures with value types \c Ts
+ */
+template <typename... Ts, std::size_t... Is>
+auto when_all_impl(std::index_sequence<Is...>, non_blocking_future<Ts>&&... futures)
+{
+  using result_type = typename when_all_result<when_all_tuple_t<Ts...>>::type;
+  using state_type = when_all_state<result_type, when_all_tuple_storage<Ts...>>;
+
+  auto* const state = new state_type{ sizeof...(Ts), when_all_tuple_storage<Ts...>{} };
+  auto future = state->get_future();
+  (when_all_watch(
+     state,
+     std::move(futures),
+     [state](auto&& value) { when_all_store(std::get<Is>(state->storage().slots), std::move(value)); }),
+   ...);
+  return future;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Returns a future which becomes ready once all \c futures are ready
+ *
+ * Nothing polls the inputs: each one counts down a single shared counter when it becomes ready, and the last one sets
+ * the combined result. If any input holds an exception, the combined future holds the first such exception instead.
+ *
+ * @param futures  futures to combine; each is left without shared state
+ *
+ * @return future holding a <code>std::tuple</code> of the values of all non-void \c futures, in order; or a
+ *         <code>non_blocking_future<void></code>, if all \c futures are void
+ */
+template <typename T, typename... Ts>
+[[nodiscard]] auto when_all(non_blocking_future<T> first, non_blocking_future<Ts>... rest)
+{
+  return detail::when_all_impl(std::index_sequence_for<T, Ts...>{}, std::move(first), std::move(rest)...);
+}
+
+/**
+ * @brief Returns a future which becomes ready once all futures in <code>[first, last)</code> are ready
+ *
+ * @param first  iterator to first future; each future in range is left without shared state
+ * @param last  iterator one past last future
+ *
+ * @return future holding a <code>std::vector</code> of the values of all futures, in order; or a
+ *         <code>non_blocking_future<void></code>, if the futures are void
+ *
+ * @see when_all(non_blocking_future<T>, non_blocking_future<Ts>...)
+ */
+template <typename IteratorT, typename T = detail::iterator_future_value_t<IteratorT>>
+[[nodiscard]] auto when_all(IteratorT first, IteratorT last)
+{
+  using result_type = std::conditional_t<std::is_void_v<T>, void, std::vector<T>>;
+  using storage_type = detail::when_all_vector_storage<T>;
+  using state_type = detail::when_all_state<result_type, storage_type>;
+
+  const auto count = static_cast<std::size_t>(std::distance(first, last));
+  if (count == 0)
+  {
+    non_blocking_promise<result_type> promise;
+    auto future = promise.get_future();
+    if constexpr (std::is_void_v<result_type>)
+    {
+      promise.set_value();
+    }
+    else
+    {
+      promise.set_value(result_type{});
+    }
+    return future;
+  }
+
+  auto* const state = new state_type{ count, storage_type{ count } };
+  auto future = state->get_future();
+  for (std::size_t index = 0; first != last; ++first, ++index)
+  {
+    detail::when_all_watch(state, std::move(*first), [state, index](auto&& value) {
+      detail::when_all_store(state->storage(), index, std::move(value));
+    });
+  }
+  return future;
+}
+
+/**
+ * @brief Returns a future which becomes ready once the first of \c futures is ready
+ *
+ * The first input to become ready sets the combined result, even if it holds an exception; results of the other
+ * inputs are discarded as they arrive.
+ *
+ * @param futures  futures to race, all with the same value type; each is left without shared state
+ *
+ * @return future holding a <code>when_any_result</code> with the position and value of the first ready input; or,
+ *         for void inputs, just its position
+ */
+template <typename T, typename... Ts>
+[[nodiscard]] auto when_any(non_blocking_future<T> first, non_blocking_future<Ts>... rest)
+{
+  static_assert((std::is_same_v<T, Ts> and ...), "when_any(futures...) requires futures with the same value type");
+
+  auto* const state = new detail::when_any_state<T>{ 1 + sizeof...(Ts) };
+  auto future = state->get_future();
+  std::size_t index = 0;
+  detail::when_any_watch(state, index++, std::move(first));
+  (detail::when_any_watch(state, index++, std::move(rest)), ...);
+  return future;
+}
+
+/**
+ * @brief Returns a future which becomes ready once the first future in <code>[first, last)</code> is ready
+ *
+ * @param first  iterator to first future; each future in range is left without shared state
+ * @param last  iterator one past last future
+ *
+ * @return future holding a <code>when_any_result</code> (or, for void futures, a position), as with the variadic
+ *         <code>when_any</code>; holds a <code>non_blocking_future_error</code> if the range is empty
+ */
+template <typename IteratorT, typename T = detail::iterator_future_value_t<IteratorT>>
+[[nodiscard]] auto when_any(IteratorT first, IteratorT last)
+{
+  using state_type = detail::when_any_state<T>;
+
+  const auto count = static_cast<std::size_t>(std::distance(first, last));
+  if (count == 0)
+  {
+    non_blocking_promise<typename state_type::result_type> promise;
+    auto future = promise.get_future();
+    promise.set_exception(std::make_exception_ptr(non_blocking_future_error{ non_blocking_future_errc::no_state }));
+    return future;
+  }
+
+  auto* const state = new state_type{ count };
+  auto future = state->get_future();
+  for (std::size_t index = 0; first != last; ++first, ++index)
+  {
+    detail::when_any_watch(state, index, std::move(*first));
+  }
+  return future;
+}
+
+}  // namespace para
@@ -39,6 +39,11 @@ public:
     work_group_dynamic::each([](auto& t) { t.join(); });
   }
 
+  /**
+   * @brief Returns number of worker threads
+   */
+  constexpr std::size_t size() const { return n_workers_; }
+
 private:
   /// Executes a callback on each worker thread
   template <typename UnaryFnT> void each(UnaryFnT&& fn)
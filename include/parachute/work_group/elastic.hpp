@@ -0,0 +1,206 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file elastic.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+
+namespace para
+{
+
+/**
+ * @brief Manages between \c min_workers and \c max_workers threads of execution, each of which runs an identical
+ *        work-loop; threads are added when work backs up, and retired after idling for too long
+ *
+ * This work group is elastic (<code>is_elastic == true</code>), and is driven by <code>pool_base</code>:
+ * <ul>
+ *   <li>when work is enqueued while no worker is parked, and at least \c spawn_depth jobs are queued, the pool calls
+ *       <code>grow()</code>, which starts another worker if fewer than \c max_workers are running</li>
+ *   <li>a worker which stays parked for \c idle_timeout with no work queued calls <code>try_retire()</code>, and
+ *       leaves its work-loop if more than \c min_workers are running</li>
+ * </ul>
+ *
+ * Retired threads are joined the next time a worker is started, or on destruction. Joins all threads on destruction.
+ */
+class work_group_elastic
+{
+public:
+  /// Work group adds and retires workers while running
+  static constexpr bool is_elastic = true;
+
+  /**
+   * @brief Starts \c min_workers workers running work callback \c f
+   *
+   * @param f  work-loop run by each worker
+   * @param min_workers  number of workers kept running, even when idle
+   * @param max_workers  maximum number of workers
+   * @param idle_timeout  time a worker stays parked, with no work queued, before it retires
+   * @param spawn_depth  number of queued jobs at which a new worker is started, if none is parked
+   */
+  template <typename WorkLoopFnT>
+  explicit work_group_elastic(
+    WorkLoopFnT f,
+    const std::size_t min_workers = 1,
+    const std::size_t max_workers = std::max(1U, std::thread::hardware_concurrency()),
+    const std::chrono::milliseconds idle_timeout = std::chrono::milliseconds{ 100 },
+    const std::size_t spawn_depth = 1)
+      : work_loop_{ std::move(f) }
+      , min_workers_{ std::max<std::size_t>(min_workers, 1) }
+      , max_workers_{ std::max(max_workers, min_workers_) }
+      , idle_timeout_{ idle_timeout }
+      , spawn_depth_{ std::max<std::size_t>(spawn_depth, 1) }
+  {
+    std::lock_guard lock{ threads_mutex_ };
+    for (std::size_t i = 0; i < min_workers_; ++i)
+    {
+      active_.fetch_add(1, std::memory_order_relaxed);
+      start();
+    }
+  }
+
+  /**
+   * @brief Waits for all work threads to join
+   */
+  ~work_group_elastic()
+  {
+    // Join without holding the lock, since jobs still running may call grow(), and workers lock on the way out
+    std::list<worker> threads;
+    {
+      std::lock_guard lock{ threads_mutex_ };
+      stopping_ = true;
+      threads.swap(threads_);
+    }
+    for (auto& w : threads)
+    {
+      w.thread.join();
+    }
+  }
+
+  /**
+   * @brief Returns number of running worker threads
+   */
+  std::size_t size() const { return active_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Returns time a worker stays parked, with no work queued, before it retires
+   */
+  constexpr std::chrono::milliseconds idle_timeout() const { return idle_timeout_; }
+
+  /**
+   * @brief Returns true if a worker should be started, given that \c queued jobs are waiting and none are parked
+   */
+  constexpr bool should_grow(const std::size_t queued) const { return queued >= spawn_depth_; }
+
+  /**
+   * @brief Starts another worker, if fewer than \c max_workers are running, and the group is not being destroyed
+   */
+  void grow()
+  {
+    auto n = active_.load(std::memory_order_relaxed);
+    do
+    {
+      if (n >= max_workers_)
+      {
+        return;
+      }
+    } while (!active_.compare_exchange_weak(n, n + 1, std::memory_order_relaxed));
+
+    std::lock_guard lock{ threads_mutex_ };
+    if (stopping_)
+    {
+      active_.fetch_sub(1, std::memory_order_relaxed);
+      return;
+    }
+    reap();
+    start();
+  }
+
+  /**
+   * @brief Claims retirement for the calling worker, if more than \c min_workers are running
+   *
+   * @return true if the calling worker must leave its work-loop
+   */
+  bool try_retire()
+  {
+    auto n = active_.load(std::memory_order_relaxed);
+    do
+    {
+      if (n <= min_workers_)
+      {
+        return false;
+      }
+    } while (!active_.compare_exchange_weak(n, n - 1, std::memory_order_relaxed));
+    return true;
+  }
+
+private:
+  /**
+   * @brief Worker thread, and whether it has left its work-loop
+   */
+  struct worker
+  {
+    /// Worker thread
+    std::thread thread;
+    /// Set by the worker once it has left its work-loop; guarded by <code>threads_mutex_</code>
+    bool finished = false;
+  };
+
+  /// Starts a worker thread; <code>threads_mutex_</code> must be held
+  void start()
+  {
+    auto& w = threads_.emplace_back();
+    w.thread = std::thread{ [this, &w] {
+      work_loop_();
+      std::lock_guard lock{ threads_mutex_ };
+      w.finished = true;
+    } };
+  }
+
+  /// Joins and removes workers which have left their work-loop; <code>threads_mutex_</code> must be held
+  void reap()
+  {
+    for (auto itr = threads_.begin(); itr != threads_.end();)
+    {
+      if (itr->finished)
+      {
+        itr->thread.join();
+        itr = threads_.erase(itr);
+      }
+      else
+      {
+        ++itr;
+      }
+    }
+  }
+
+  /// Work-loop run by each worker
+  std::function<void()> work_loop_;
+  /// Number of workers kept running, even when idle
+  std::size_t min_workers_;
+  /// Maximum number of workers
+  std::size_t max_workers_;
+  /// Time a worker stays parked, with no work queued, before it retires
+  std::chrono::milliseconds idle_timeout_;
+  /// Number of queued jobs at which a new worker is started
+  std::size_t spawn_depth_;
+  /// Number of running workers, which have not claimed retirement
+  std::atomic<std::size_t> active_ = 0;
+  /// Protects threads_ and stopping_
+  std::mutex threads_mutex_;
+  /// Set on destruction, after which no workers are started
+  bool stopping_ = false;
+  /// All worker threads, including retired threads which have not been joined
+  std::list<worker> threads_;
+};
+
+}  // namespace para
@@ -0,0 +1,251 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file pinned.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#if defined(__linux__)
+// POSIX
+#include <pthread.h>
+#include <sched.h>
+#endif  // defined(__linux__)
+
+// Parachute
+#include <parachute/utility/cpu_topology.hpp>
+
+namespace para
+{
+
+/**
+ * @brief Strategies for choosing which CPU each worker of a <code>work_group_pinned</code> runs on
+ */
+enum class cpu_placement
+{
+  compact,  ///< fill each core (all SMT siblings), then each package, before moving to the next
+  compact_no_smt,  ///< as \c compact, but with one CPU per core
+  scatter,  ///< spread workers across packages, then across cores, before sharing cores between SMT siblings
+  scatter_no_smt  ///< as \c scatter, but with one CPU per core
+};
+
+namespace detail
+{
+
+/**
+ * @brief CPU which the calling thread is pinned to, if it is a worker of a <code>work_group_pinned</code>
+ */
+inline thread_local std::optional<utility::cpu_info> worker_cpu;
+
+/**
+ * @brief Removes CPUs which the calling process may not run on (e.g. due to <code>taskset</code> or cgroups)
+ */
+inline std::vector<utility::cpu_info> allowed_cpus(std::vector<utility::cpu_info> topology)
+{
+#if defined(__linux__)
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (::sched_getaffinity(0, sizeof(allowed), &allowed) == 0)
+  {
+    const auto not_allowed = [&allowed](const utility::cpu_info& info) {
+      return info.cpu >= CPU_SETSIZE or !CPU_ISSET(info.cpu, &allowed);
+    };
+    const auto remaining = std::remove_if(topology.begin(), topology.end(), not_allowed);
+    if (remaining != topology.begin())
+    {
+      topology.erase(remaining, topology.end());
+    }
+  }
+#endif  // defined(__linux__)
+  return topology;
+}
+
+/**
+ * @brief Orders \c topology according to \c placement; workers are assigned CPUs from the front of the result
+ */
+inline std::vector<utility::cpu_info> order_cpus(std::vector<utility::cpu_info> topology, const cpu_placement placement)
+{
+  std::sort(topology.begin(), topology.end(), [](const utility::cpu_info& lhs, const utility::cpu_info& rhs) {
+    return std::tie(lhs.package, lhs.core, lhs.cpu) < std::tie(rhs.package, rhs.core, rhs.cpu);
+  });
+
+  const bool no_smt = (placement == cpu_placement::compact_no_smt or placement == cpu_placement::scatter_no_smt);
+  const bool scatter = (placement == cpu_placement::scatter or placement == cpu_placement::scatter_no_smt);
+
+  // Sorting by (SMT rank, rank of core within its package, package) spreads CPUs across packages, then across cores
+  std::vector<std::tuple<unsigned, unsigned, unsigned, std::size_t>> keys;
+  unsigned smt_rank = 0;
+  unsigned core_rank = 0;
+  for (std::size_t i = 0; i < topology.size(); ++i)
+  {
+    if (i == 0 or topology[i].package != topology[i - 1].package)
+    {
+      smt_rank = 0;
+      core_rank = 0;
+    }
+    else if (topology[i].core != topology[i - 1].core)
+    {
+      smt_rank = 0;
+      ++core_rank;
+    }
+    else
+    {
+      ++smt_rank;
+    }
+
+    if (!no_smt or smt_rank == 0)
+    {
+      keys.emplace_back(smt_rank, core_rank, topology[i].package, i);
+    }
+  }
+
+  if (scatter)
+  {
+    std::sort(keys.begin(), keys.end());
+  }
+
+  std::vector<utility::cpu_info> ordered;
+  ordered.reserve(keys.size());
+  for (const auto& key : keys)
+  {
+    ordered.push_back(topology[std::get<3>(key)]);
+  }
+  return ordered;
+}
+
+/**
+ * @brief Pins the calling thread to \c cpu
+ *
+ * @return true if the thread was pinned; always false on platforms other than Linux
+ */
+inline bool pin_this_thread(const unsigned cpu)
+{
+#if defined(__linux__)
+  if (cpu >= CPU_SETSIZE)
+  {
+    return false;
+  }
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(cpu, &cpus);
+  return ::pthread_setaffinity_np(::pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+  return false;
+#endif  // defined(__linux__)
+}
+
+}  // namespace detail
+
+namespace this_worker
+{
+
+/**
+ * @brief Returns CPU (and NUMA node) which the calling thread is pinned to
+ *
+ * @return CPU location, if called from a worker of a <code>work_group_pinned</code> which was successfully pinned;
+ *         otherwise, <code>std::nullopt</code>
+ */
+inline std::optional<utility::cpu_info> cpu() { return detail::worker_cpu; }
+
+}  // namespace this_worker
+
+/**
+ * @brief Managers N threads of execution, decided at runtime, each pinned to its own CPU
+ *
+ * CPU topology is read from sysfs (see <code>utility::read_cpu_topology</code>), and restricted to the CPUs the
+ * process may run on. If there are more workers than CPUs, CPUs are reused in the same order. A worker which can't be
+ * pinned runs unpinned.
+ *
+ * Joins threads on destruction
+ */
+class work_group_pinned
+{
+public:
+  /**
+   * @brief Starts all workers running work callback \c f, on CPUs chosen by \c placement
+   */
+  template <typename WorkLoopFnT>
+  explicit work_group_pinned(
+    WorkLoopFnT f,
+    const std::size_t n_workers = std::thread::hardware_concurrency(),
+    const cpu_placement placement = cpu_placement::compact)
+      : work_group_pinned{
+          std::move(f),
+          n_workers,
+          detail::order_cpus(detail::allowed_cpus(utility::read_cpu_topology()), placement)
+        }
+  {}
+
+  /**
+   * @brief Starts one worker per CPU in \c cpus, each running work callback \c f
+   */
+  template <typename WorkLoopFnT>
+  work_group_pinned(WorkLoopFnT f, const std::vector<unsigned>& cpus)
+      : work_group_pinned{ std::move(f), cpus.size(), select_cpus(utility::read_cpu_topology(), cpus) }
+  {}
+
+  /**
+   * @brief Waits for all work threads to join
+   */
+  ~work_group_pinned()
+  {
+    std::for_each(workers_.get(), workers_.get() + n_workers_, [](auto& t) { t.join(); });
+  }
+
+  /**
+   * @brief Returns number of worker threads
+   */
+  constexpr std::size_t size() const { return n_workers_; }
+
+private:
+  template <typename WorkLoopFnT>
+  work_group_pinned(WorkLoopFnT f, const std::size_t n_workers, const std::vector<utility::cpu_info>& cpus)
+      : workers_{ std::make_unique<std::thread[]>(n_workers) }, n_workers_{ n_workers }
+  {
+    for (std::size_t i = 0; i < n_workers_; ++i)
+    {
+      std::optional<utility::cpu_info> cpu;
+      if (!cpus.empty())
+      {
+        cpu = cpus[i % cpus.size()];
+      }
+      workers_[i] = std::thread{ [f, cpu] {
+        if (cpu.has_value() and detail::pin_this_thread(cpu->cpu))
+        {
+          detail::worker_cpu = cpu;
+        }
+        f();
+      } };
+    }
+  }
+
+  /// Returns location of each CPU in \c cpus, in order; CPUs missing from \c topology are given default locations
+  static std::vector<utility::cpu_info>
+  select_cpus(const std::vector<utility::cpu_info>& topology, const std::vector<unsigned>& cpus)
+  {
+    std::vector<utility::cpu_info> selected;
+    selected.reserve(cpus.size());
+    for (const unsigned cpu : cpus)
+    {
+      const auto itr = std::find_if(
+        topology.begin(), topology.end(), [cpu](const utility::cpu_info& info) { return info.cpu == cpu; });
+      selected.push_back(itr == topology.end() ? utility::cpu_info{ cpu, cpu, 0, 0 } : *itr);
+    }
+    return selected;
+  }
+
+  /// Worker threads
+  std::unique_ptr<std::thread[]> workers_;
+  /// Worker thread count
+  std::size_t n_workers_;
+};
+
+}  // namespace para
@@ -41,6 +41,11 @@ public:
     work_group_static::each([](auto& t) { t.join(); });
   }
 
+  /**
+   * @brief Returns number of worker threads
+   */
+  static constexpr std::size_t size() { return N; }
+
 private:
   /// Executes a callback on each worker thread
   template <typename UnaryFnT> void each(UnaryFnT&& fn)
@@ -71,6 +76,11 @@ public:
    */
   ~work_group_static() { worker_.join(); }
 
+  /**
+   * @brief Returns number of worker threads
+   */
+  static constexpr std::size_t size() { return 1; }
+
 private:
   /// Worker thread
   std::thread worker_;
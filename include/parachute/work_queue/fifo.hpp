@@ -6,20 +6,25 @@
 #pragma once
 
 // C++ Standard Library
-#include <functional>
 #include <utility>
 #include <vector>
 
+// Parachute
+#include <parachute/task.hpp>
+
 namespace para
 {
 
 /**
  * @brief Represents a default, first-in-first-out (FIFO) work queue
  */
-template <typename WorkStorageT = std::function<void()>, typename WorkStorageAllocatorT = std::allocator<WorkStorageT>>
+template <typename WorkStorageT = task, typename WorkStorageAllocatorT = std::allocator<WorkStorageT>>
 class work_queue_fifo
 {
 public:
+  /// Type used to hold each unit of work
+  using work_storage_type = WorkStorageT;
+
   /**
    * @brief Returns next job to run
    * @warning behavior is undefined if <code>empty() == true</code>
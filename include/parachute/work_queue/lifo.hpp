@@ -7,19 +7,24 @@
 
 // C++ Standard Library
 #include <deque>
-#include <functional>
 #include <utility>
 
+// Parachute
+#include <parachute/task.hpp>
+
 namespace para
 {
 
 /**
  * @brief Represents a default, last-in-first-out (LIFO) work queue
  */
-template <typename WorkStorageT = std::function<void()>, typename WorkStorageAllocatorT = std::allocator<WorkStorageT>>
+template <typename WorkStorageT = task, typename WorkStorageAllocatorT = std::allocator<WorkStorageT>>
 class work_queue_lifo
 {
 public:
+  /// Type used to hold each unit of work
+  using work_storage_type = WorkStorageT;
+
   /**
    * @brief Returns next job to run
    * @warning behavior is undefined if <code>empty() == true</code>
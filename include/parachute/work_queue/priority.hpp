@@ -0,0 +1,124 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file priority.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <utility>
+
+// Parachute
+#include <parachute/task.hpp>
+
+namespace para
+{
+
+/**
+ * @brief Represents a work queue with a fixed number of priority levels
+ *
+ * Work is popped from the most urgent non-empty level, where level 0 is the most urgent; jobs within a level run in
+ * the order they were enqueued. Work enqueued without a priority goes to the least urgent level, so that untagged
+ * (e.g. bulk algorithm) work never delays work which was given a priority.
+ *
+ * With aging enabled, every \c AgingPeriodV pops, the oldest job of each non-empty level is moved up one level, so
+ * that work at a less urgent level is never starved by a steady stream of more urgent work.
+ *
+ * @tparam LevelsV  number of priority levels
+ * @tparam AgingPeriodV  number of pops between aging steps; 0 disables aging
+ * @tparam WorkStorageT  type used to hold each unit of work
+ */
+template <
+  std::size_t LevelsV = 3,
+  std::size_t AgingPeriodV = 0,
+  typename WorkStorageT = task,
+  typename WorkStorageAllocatorT = std::allocator<WorkStorageT>>
+class work_queue_priority
+{
+  static_assert(LevelsV > 0, "work_queue_priority<N> must have (N > 0) priority levels");
+
+public:
+  /// Type used to hold each unit of work
+  using work_storage_type = WorkStorageT;
+
+  /// Number of priority levels
+  static constexpr std::size_t levels = LevelsV;
+
+  /// Priority given to work enqueued without one
+  static constexpr std::size_t default_priority = LevelsV - 1;
+
+  /**
+   * @brief Returns next job to run
+   * @warning behavior is undefined if <code>empty() == true</code>
+   */
+  [[nodiscard]] WorkStorageT pop()
+  {
+    if constexpr (AgingPeriodV > 0)
+    {
+      if (++pops_since_aging_ == AgingPeriodV)
+      {
+        pops_since_aging_ = 0;
+        age();
+      }
+    }
+
+    auto* level = c_.data();
+    while (level->empty())
+    {
+      ++level;
+    }
+    WorkStorageT next_job{ std::move(level->front()) };
+    level->pop_front();
+    --size_;
+    return next_job;
+  }
+
+  /**
+   * @brief Adds new \c work to the queue, at the least urgent level
+   */
+  template <typename WorkT> void enqueue(WorkT&& work) { enqueue(std::forward<WorkT>(work), default_priority); }
+
+  /**
+   * @brief Adds new \c work to the queue, at level \c priority
+   *
+   * @param priority  priority level, where 0 is the most urgent; levels past the last are clamped to it
+   */
+  template <typename WorkT> void enqueue(WorkT&& work, const std::size_t priority)
+  {
+    c_[priority < LevelsV ? priority : default_priority].emplace_back(std::forward<WorkT>(work));
+    ++size_;
+  }
+
+  /**
+   * @brief Returns true if queue contains no work
+   */
+  constexpr bool empty() const { return size_ == 0; }
+
+private:
+  /// Moves oldest job of each non-empty level up one level
+  void age()
+  {
+    for (std::size_t priority = 1; priority < LevelsV; ++priority)
+    {
+      auto& level = c_[priority];
+      if (!level.empty())
+      {
+        c_[priority - 1].emplace_back(std::move(level.front()));
+        level.pop_front();
+      }
+    }
+  }
+
+  /// Underlying queue storage, one queue per priority level
+  std::array<std::deque<WorkStorageT, WorkStorageAllocatorT>, LevelsV> c_;
+  /// Number of jobs across all levels
+  std::size_t size_ = 0;
+  /// Number of pops since work was last aged
+  std::size_t pops_since_aging_ = 0;
+};
+
+}  // namespace para
@@ -0,0 +1,172 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file ring.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <utility>
+
+// Parachute
+#include <parachute/task.hpp>
+#include <parachute/utility/cache_line.hpp>
+#include <parachute/utility/uninitialized.hpp>
+
+namespace para
+{
+
+/**
+ * @brief Represents a bounded, lock-free, multi-producer multi-consumer, first-in-first-out (FIFO) work queue
+ *
+ * Work is stored in a fixed ring of cache-line-padded slots. Each slot carries a sequence number which tells
+ * producers and consumers, which claim positions with atomic head and tail counters, whether that slot is free or
+ * full. Storage is never reallocated.
+ *
+ * This queue handles its own synchronization (<code>is_concurrent == true</code>), so <code>pool_base</code> does not
+ * serialize access to it.
+ *
+ * @tparam CapacityV  maximum number of jobs held at once; must be a power of two
+ * @tparam WorkStorageT  type used to hold each unit of work
+ *
+ * @warning <code>enqueue</code> yields until a slot is free when the queue is full; a worker which fills the queue from
+ *          inside a task will wait forever if no other worker is left to drain it
+ *
+ * @see "Bounded MPMC queue", Dmitry Vyukov, 1024cores.net
+ */
+template <std::size_t CapacityV, typename WorkStorageT = task> class work_queue_ring
+{
+  static_assert(CapacityV > 1, "work_queue_ring<N> must have (N > 1) slots");
+  static_assert((CapacityV & (CapacityV - 1)) == 0, "work_queue_ring<N> must have a power-of-two number of slots");
+
+public:
+  /// Type used to hold each unit of work
+  using work_storage_type = WorkStorageT;
+
+  /// Queue synchronizes concurrent access itself
+  static constexpr bool is_concurrent = true;
+
+  work_queue_ring() : slots_{ std::make_unique<slot[]>(CapacityV) }
+  {
+    for (std::size_t i = 0; i < CapacityV; ++i)
+    {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  work_queue_ring(const work_queue_ring&) = delete;
+
+  /**
+   * @brief Releases all work which was never run
+   */
+  ~work_queue_ring()
+  {
+    while (try_pop())
+    {}
+  }
+
+  /**
+   * @brief Returns next job to run, if any is available
+   */
+  [[nodiscard]] std::optional<WorkStorageT> try_pop()
+  {
+    std::size_t pos = head_.load(std::memory_order_relaxed);
+    while (true)
+    {
+      slot& s = slots_[pos & mask];
+      const std::size_t seq = s.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+      if (diff == 0)
+      {
+        if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          std::optional<WorkStorageT> next_job{ s.storage.get() };
+          s.sequence.store(pos + CapacityV, std::memory_order_release);
+          return next_job;
+        }
+      }
+      else if (diff < 0)
+      {
+        // Slot not yet filled; queue is empty
+        return std::nullopt;
+      }
+      else
+      {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief Adds new \c work to the queue
+   */
+  template <typename WorkT> void enqueue(WorkT&& work)
+  {
+    std::size_t pos = tail_.load(std::memory_order_relaxed);
+    while (true)
+    {
+      slot& s = slots_[pos & mask];
+      const std::size_t seq = s.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+      if (diff == 0)
+      {
+        if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          s.storage.emplace(std::forward<WorkT>(work));
+          s.sequence.store(pos + 1, std::memory_order_release);
+          return;
+        }
+      }
+      else if (diff < 0)
+      {
+        // Slot not yet consumed; queue is full
+        std::this_thread::yield();
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+      else
+      {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief Returns true if queue appears to contain no work
+   */
+  bool empty() const { return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Returns maximum number of jobs held at once
+   */
+  static constexpr std::size_t capacity() { return CapacityV; }
+
+private:
+  /// Maps a position to a slot index
+  static constexpr std::size_t mask = CapacityV - 1;
+
+  /**
+   * @brief Storage for a single job
+   */
+  struct alignas(utility::cache_line_size) slot
+  {
+    /// Position at which this slot is next free (== position) or full (== position + 1)
+    std::atomic<std::size_t> sequence;
+    /// Job storage
+    utility::uninitialized<WorkStorageT> storage;
+  };
+
+  /// Job storage
+  std::unique_ptr<slot[]> slots_;
+  /// Position of next job to pop
+  alignas(utility::cache_line_size) std::atomic<std::size_t> head_ = 0;
+  /// Position of next job to enqueue
+  alignas(utility::cache_line_size) std::atomic<std::size_t> tail_ = 0;
+};
+
+}  // namespace para
@@ -0,0 +1,287 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file stealing.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+// Parachute
+#include <parachute/task.hpp>
+#include <parachute/utility/cache_line.hpp>
+#include <parachute/utility/slab.hpp>
+#include <parachute/utility/work_stealing_deque.hpp>
+
+namespace para
+{
+
+/**
+ * @brief Represents a work-stealing work queue
+ *
+ * Each worker which pops from the queue is given its own Chase-Lev deque. Work enqueued from a worker goes to the
+ * bottom of that worker's deque, and is popped back in last-in-first-out order. Work enqueued from any other thread
+ * goes to a shared injection queue. A worker with no local work tries the injection queue, then steals from the top
+ * of the deques of other workers, starting from a random victim.
+ *
+ * Workers past \c MaxWorkersV do not get a deque; they only take work from the injection queue or by stealing.
+ *
+ * This queue handles its own synchronization (<code>is_concurrent == true</code>), so <code>pool_base</code> does not
+ * serialize access to it.
+ *
+ * @tparam WorkStorageT  type used to hold each unit of work
+ * @tparam WorkStorageAllocatorT  allocator for work storage; must be safe to use from several threads. The default
+ *         recycles storage through thread-local free lists, since jobs are often freed on a different thread than the
+ *         one which allocated them
+ * @tparam MaxWorkersV  maximum number of workers given a local deque
+ */
+template <
+  typename WorkStorageT = task,
+  typename WorkStorageAllocatorT = utility::slab_allocator<WorkStorageT>,
+  std::size_t MaxWorkersV = 256>
+class work_queue_stealing
+{
+public:
+  /// Type used to hold each unit of work
+  using work_storage_type = WorkStorageT;
+
+  /// Queue synchronizes concurrent access itself
+  static constexpr bool is_concurrent = true;
+
+  work_queue_stealing() = default;
+
+  work_queue_stealing(const work_queue_stealing&) = delete;
+
+  /**
+   * @brief Releases all work which was never run
+   */
+  ~work_queue_stealing()
+  {
+    WorkStorageT* job = nullptr;
+    for (auto& d : deques_)
+    {
+      if (auto* const q = d.load(std::memory_order_relaxed); q != nullptr)
+      {
+        while (q->pop(job))
+        {
+          release(job);
+        }
+        delete q;
+      }
+    }
+    std::for_each(injected_.begin(), injected_.end(), [this](auto* j) { release(j); });
+  }
+
+  /**
+   * @brief Returns next job to run, if any is available
+   *
+   * Registers the calling thread as a worker on its first call
+   */
+  [[nodiscard]] std::optional<WorkStorageT> try_pop()
+  {
+    auto& state = local();
+    if (state.owner != this)
+    {
+      register_worker(state);
+    }
+    return take(state);
+  }
+
+  /**
+   * @brief Returns next job to run, if any is available, without registering the calling thread as a worker
+   *
+   * Used by threads which run work while they wait (see <code>pool_base::try_run_one</code>); such threads take work
+   * from the injection queue, or steal it, but are not given a deque of their own
+   */
+  [[nodiscard]] std::optional<WorkStorageT> try_pop_external()
+  {
+    if (auto& state = local(); state.owner == this)
+    {
+      return take(state);
+    }
+    local_state visitor;
+    visitor.seed = static_cast<std::uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1U;
+    return take(visitor);
+  }
+
+  /**
+   * @brief Adds new \c work to the queue
+   *
+   * Work enqueued from a worker goes to its local deque; otherwise, it goes to the injection queue
+   */
+  template <typename WorkT> void enqueue(WorkT&& work)
+  {
+    WorkStorageT* const job = std::allocator_traits<WorkStorageAllocatorT>::allocate(allocator_, 1);
+    std::allocator_traits<WorkStorageAllocatorT>::construct(allocator_, job, std::forward<WorkT>(work));
+
+    if (const auto& state = local(); state.owner == this and state.deque != nullptr)
+    {
+      state.deque->push(job);
+    }
+    else
+    {
+      std::lock_guard lock{ injected_mutex_ };
+      injected_.push_back(job);
+      injected_count_.fetch_add(1, std::memory_order_release);
+    }
+  }
+
+  /**
+   * @brief Returns true if queue appears to contain no work
+   */
+  bool empty() const
+  {
+    if (injected_count_.load(std::memory_order_acquire) > 0)
+    {
+      return false;
+    }
+    const std::size_t n = registered_count();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      if (const auto* const q = deques_[i].load(std::memory_order_acquire); q != nullptr and !q->empty())
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  using deque_type = utility::work_stealing_deque<WorkStorageT*>;
+
+  /**
+   * @brief Per-thread worker state
+   */
+  struct local_state
+  {
+    /// Queue which the calling thread is a worker of
+    const work_queue_stealing* owner = nullptr;
+    /// Deque owned by the calling thread
+    deque_type* deque = nullptr;
+    /// Index of deque owned by the calling thread
+    std::size_t index = MaxWorkersV;
+    /// Random victim selection state
+    std::uint32_t seed = 0;
+  };
+
+  /// Returns worker state for the calling thread
+  static local_state& local()
+  {
+    static thread_local local_state state;
+    return state;
+  }
+
+  /// Returns number of deque slots which may be in use
+  std::size_t registered_count() const
+  {
+    return std::min(registered_.load(std::memory_order_acquire), MaxWorkersV);
+  }
+
+  /// Gives the calling thread a local deque, if any are left
+  void register_worker(local_state& state)
+  {
+    state.owner = this;
+    state.deque = nullptr;
+    state.index = registered_.fetch_add(1, std::memory_order_acq_rel);
+    state.seed = static_cast<std::uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1U;
+    if (state.index < MaxWorkersV)
+    {
+      state.deque = new deque_type{};
+      deques_[state.index].store(state.deque, std::memory_order_release);
+    }
+  }
+
+  /// Takes a job from the local deque of \c state, the injection queue, or another worker, in that order
+  std::optional<WorkStorageT> take(local_state& state)
+  {
+    WorkStorageT* job = nullptr;
+    if ((state.deque != nullptr and state.deque->pop(job)) or pop_injected(job) or steal(state, job))
+    {
+      std::optional<WorkStorageT> next_job{ std::move(*job) };
+      release(job);
+      return next_job;
+    }
+    return std::nullopt;
+  }
+
+  /// Takes the oldest job from the injection queue
+  bool pop_injected(WorkStorageT*& job)
+  {
+    if (injected_count_.load(std::memory_order_acquire) == 0)
+    {
+      return false;
+    }
+    std::lock_guard lock{ injected_mutex_ };
+    if (injected_.empty())
+    {
+      return false;
+    }
+    job = injected_.front();
+    injected_.pop_front();
+    injected_count_.fetch_sub(1, std::memory_order_release);
+    return true;
+  }
+
+  /// Steals a job from another worker, starting from a random victim
+  bool steal(local_state& state, WorkStorageT*& job)
+  {
+    const std::size_t n = registered_count();
+    if (n == 0)
+    {
+      return false;
+    }
+
+    // xorshift32
+    state.seed ^= state.seed << 13;
+    state.seed ^= state.seed >> 17;
+    state.seed ^= state.seed << 5;
+
+    const std::size_t first = state.seed % n;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      const std::size_t victim = (first + i) % n;
+      if (victim == state.index)
+      {
+        continue;
+      }
+      else if (auto* const q = deques_[victim].load(std::memory_order_acquire); q != nullptr and q->steal(job))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Destroys and deallocates a job
+  void release(WorkStorageT* const job)
+  {
+    std::allocator_traits<WorkStorageAllocatorT>::destroy(allocator_, job);
+    std::allocator_traits<WorkStorageAllocatorT>::deallocate(allocator_, job, 1);
+  }
+
+  /// Per-worker deques
+  std::array<std::atomic<deque_type*>, MaxWorkersV> deques_ = {};
+  /// Number of workers which have registered
+  alignas(utility::cache_line_size) std::atomic<std::size_t> registered_ = 0;
+  /// Number of jobs in the injection queue
+  alignas(utility::cache_line_size) std::atomic<std::size_t> injected_count_ = 0;
+  /// Protects the injection queue
+  std::mutex injected_mutex_;
+  /// Work enqueued from threads which are not workers
+  std::deque<WorkStorageT*> injected_;
+  /// Allocates work storage
+  WorkStorageAllocatorT allocator_;
+};
+
+}  // namespace para
@@ -12,5 +12,19 @@ template class pool_base<work_group_static<1>, work_queue_lifo<>, work_control_d
 template class pool_base<work_group_static<1>, work_queue_lifo<>, work_control_strict>;
 template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_default>;
 template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_strict>;
+template class pool_base<work_group_dynamic, work_queue_stealing<>, work_control_default>;
+template class pool_base<work_group_dynamic, work_queue_stealing<>, work_control_strict>;
+template class pool_base<work_group_dynamic, work_queue_priority<>, work_control_default>;
+template class pool_base<work_group_dynamic, work_queue_priority<>, work_control_strict>;
+template class pool_base<work_group_pinned, work_queue_lifo<>, work_control_default>;
+template class pool_base<work_group_pinned, work_queue_lifo<>, work_control_strict>;
+template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_idle<idle_spin<>>>;
+template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_idle<idle_spin<>, work_control_strict>>;
+template class pool_base<work_group_elastic, work_queue_lifo<>, work_control_default>;
+template class pool_base<work_group_elastic, work_queue_lifo<>, work_control_strict>;
+template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_stats<>>;
+template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_stats<work_control_strict>>;
+template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_trace<>>;
+template class pool_base<work_group_dynamic, work_queue_lifo<>, work_control_trace<work_control_strict>>;
 
 }  // namespace para
\ No newline at end of file
@@ -6,6 +6,7 @@
 
 // C++ Standard Library
 #include <algorithm>
+#include <list>
 #include <vector>
 
 // GTest
@@ -50,3 +51,147 @@ TEST(ForEach, FullSequence)
 
   EXPECT_EQ(mutated_seqeunce, expected_seqeunce);
 }
+
+
+TEST(ForEach, FullSequenceStealing)
+{
+  using pool_type = pool_stealing;
+
+  pool_type wp;
+
+  std::vector<double> mutated_seqeunce(1000, 1.0);
+
+  std::vector<double> expected_seqeunce = mutated_seqeunce;
+  std::for_each(expected_seqeunce.begin(), expected_seqeunce.end(), [](double& v) { v *= 2; });
+
+  algorithm::for_each(wp, mutated_seqeunce.begin(), mutated_seqeunce.end(), [](double& v) { v *= 2; });
+
+  EXPECT_EQ(mutated_seqeunce, expected_seqeunce);
+}
+
+
+TEST(ForEach, FullSequenceStaticPartitioner)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<double> mutated_seqeunce(1001, 1.0);
+
+  std::vector<double> expected_seqeunce = mutated_seqeunce;
+  std::for_each(expected_seqeunce.begin(), expected_seqeunce.end(), [](double& v) { v *= 2; });
+
+  algorithm::for_each(
+    wp,
+    mutated_seqeunce.begin(),
+    mutated_seqeunce.end(),
+    [](double& v) { v *= 2; },
+    algorithm::static_partitioner{ 64 });
+
+  EXPECT_EQ(mutated_seqeunce, expected_seqeunce);
+}
+
+
+TEST(ForEach, FullSequenceDynamicPartitioner)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<double> mutated_seqeunce(1001, 1.0);
+
+  std::vector<double> expected_seqeunce = mutated_seqeunce;
+  std::for_each(expected_seqeunce.begin(), expected_seqeunce.end(), [](double& v) { v *= 2; });
+
+  algorithm::for_each(
+    wp,
+    mutated_seqeunce.begin(),
+    mutated_seqeunce.end(),
+    [](double& v) { v *= 2; },
+    algorithm::dynamic_partitioner{ 16 });
+
+  EXPECT_EQ(mutated_seqeunce, expected_seqeunce);
+}
+
+
+TEST(ForEach, FullSequenceGuidedPartitioner)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<double> mutated_seqeunce(1001, 1.0);
+
+  std::vector<double> expected_seqeunce = mutated_seqeunce;
+  std::for_each(expected_seqeunce.begin(), expected_seqeunce.end(), [](double& v) { v *= 2; });
+
+  algorithm::for_each(
+    wp,
+    mutated_seqeunce.begin(),
+    mutated_seqeunce.end(),
+    [](double& v) { v *= 2; },
+    algorithm::guided_partitioner{ 4 });
+
+  EXPECT_EQ(mutated_seqeunce, expected_seqeunce);
+}
+
+
+TEST(ForEach, FullSequenceNonRandomAccess)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::list<double> mutated_seqeunce(1001, 1.0);
+
+  std::list<double> expected_seqeunce = mutated_seqeunce;
+  std::for_each(expected_seqeunce.begin(), expected_seqeunce.end(), [](double& v) { v *= 2; });
+
+  algorithm::for_each(
+    wp,
+    mutated_seqeunce.begin(),
+    mutated_seqeunce.end(),
+    [](double& v) { v *= 2; },
+    algorithm::guided_partitioner{ 4 });
+
+  EXPECT_EQ(mutated_seqeunce, expected_seqeunce);
+}
+
+
+TEST(ForEach, NestedOnSingleWorker)
+{
+  using pool_type = worker;
+
+  pool_type wp;
+
+  std::vector<std::vector<double>> mutated_seqeunce(8, std::vector<double>(100, 1.0));
+
+  // The only worker waits on inner loops; it must run their work itself
+  algorithm::for_each(wp, mutated_seqeunce.begin(), mutated_seqeunce.end(), [&wp](std::vector<double>& inner) {
+    algorithm::for_each(wp, inner.begin(), inner.end(), [](double& v) { v *= 2; });
+  });
+
+  EXPECT_EQ(mutated_seqeunce, std::vector<std::vector<double>>(8, std::vector<double>(100, 2.0)));
+}
+
+
+TEST(ForEach, NestedStealingDynamicPartitioner)
+{
+  using pool_type = pool_stealing;
+
+  pool_type wp;
+
+  std::vector<std::vector<double>> mutated_seqeunce(64, std::vector<double>(100, 1.0));
+
+  algorithm::for_each(
+    wp,
+    mutated_seqeunce.begin(),
+    mutated_seqeunce.end(),
+    [&wp](std::vector<double>& inner) {
+      algorithm::for_each(
+        wp, inner.begin(), inner.end(), [](double& v) { v *= 2; }, algorithm::dynamic_partitioner{ 8 });
+    },
+    algorithm::dynamic_partitioner{ 1 });
+
+  EXPECT_EQ(mutated_seqeunce, std::vector<std::vector<double>>(64, std::vector<double>(100, 2.0)));
+}
@@ -0,0 +1,104 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file reduce.cpp
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/algorithm/reduce.hpp>
+#include <parachute/pool.hpp>
+
+using namespace para;
+
+
+TEST(Reduce, EmptySequence)
+{
+  using pool_type = worker;
+
+  pool_type wp;
+
+  const std::vector<int> sequence = {};
+
+  EXPECT_EQ(algorithm::reduce(wp, sequence.begin(), sequence.end(), 5), 5);
+}
+
+
+TEST(Reduce, FullSequence)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<int> sequence(1001);
+  std::iota(sequence.begin(), sequence.end(), 0);
+
+  EXPECT_EQ(
+    algorithm::reduce(wp, sequence.begin(), sequence.end(), 5), std::accumulate(sequence.begin(), sequence.end(), 5));
+}
+
+
+TEST(Reduce, FullSequenceNonRandomAccess)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::list<int> sequence(1001);
+  std::iota(sequence.begin(), sequence.end(), 0);
+
+  EXPECT_EQ(
+    algorithm::reduce(wp, sequence.begin(), sequence.end(), 0, std::plus<>{}, algorithm::guided_partitioner{ 4 }),
+    std::accumulate(sequence.begin(), sequence.end(), 0));
+}
+
+
+TEST(Reduce, MaxElement)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<int> sequence(1001);
+  std::iota(sequence.begin(), sequence.end(), 0);
+  std::swap(sequence.front(), sequence[500]);
+
+  EXPECT_EQ(
+    algorithm::reduce(
+      wp,
+      sequence.begin(),
+      sequence.end(),
+      -1,
+      [](int lhs, int rhs) { return std::max(lhs, rhs); },
+      algorithm::dynamic_partitioner{ 10 }),
+    1000);
+}
+
+
+TEST(Reduce, DeterministicAcrossWorkerCounts)
+{
+  std::vector<float> sequence(10007);
+  for (std::size_t i = 0; i < sequence.size(); ++i)
+  {
+    sequence[i] = 1.f / static_cast<float>(i + 1);
+  }
+
+  static_pool<2> wp_2;
+  static_pool<4> wp_4;
+
+  const auto reduced_2 =
+    algorithm::reduce(wp_2, sequence.begin(), sequence.end(), 0.f, std::plus<>{}, algorithm::static_partitioner{ 64 });
+  const auto reduced_4 =
+    algorithm::reduce(wp_4, sequence.begin(), sequence.end(), 0.f, std::plus<>{}, algorithm::dynamic_partitioner{ 64 });
+
+  EXPECT_EQ(reduced_2, reduced_4);
+}
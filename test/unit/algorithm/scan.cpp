@@ -0,0 +1,231 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file scan.cpp
+ */
+
+// C++ Standard Library
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/algorithm/scan.hpp>
+#include <parachute/pool.hpp>
+
+using namespace para;
+
+
+TEST(InclusiveScan, EmptySequence)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  const std::vector<int> sequence = {};
+  std::vector<int> output;
+
+  EXPECT_EQ(algorithm::inclusive_scan(wp, sequence.begin(), sequence.end(), output.begin()), output.end());
+}
+
+
+TEST(InclusiveScan, FullSequence)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<int> sequence(1001);
+  std::iota(sequence.begin(), sequence.end(), 0);
+
+  std::vector<int> expected(sequence.size());
+  std::inclusive_scan(sequence.begin(), sequence.end(), expected.begin());
+
+  std::vector<int> output(sequence.size());
+  EXPECT_EQ(algorithm::inclusive_scan(wp, sequence.begin(), sequence.end(), output.begin()), output.end());
+  EXPECT_EQ(output, expected);
+}
+
+
+TEST(InclusiveScan, FullSequenceInitDynamicPartitioner)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<int> sequence(1001);
+  std::iota(sequence.begin(), sequence.end(), 0);
+
+  std::vector<int> expected(sequence.size());
+  std::inclusive_scan(sequence.begin(), sequence.end(), expected.begin(), std::plus<>{}, 7);
+
+  std::vector<int> output(sequence.size());
+  algorithm::inclusive_scan(
+    wp, sequence.begin(), sequence.end(), output.begin(), std::plus<>{}, 7, algorithm::dynamic_partitioner{ 64 });
+  EXPECT_EQ(output, expected);
+}
+
+
+TEST(InclusiveScan, InPlace)
+{
+  using pool_type = pool;
+
+  pool_type wp;
+
+  std::vector<int> sequence(10007, 1);
+
+  algorithm::inclusive_scan(wp, sequence.begin(), sequence.end(), sequence.begin());
+
+  for (std::size_t i = 0; i < sequence.size(); ++i)
+  {
+    ASSERT_EQ(sequence[i], static_cast<int>(i + 1));
+  }
+}
+
+
+TEST(InclusiveScan, NonCommutativeOp)
+{
+  using pool_type = static_pool<3>;
+
+  pool_type wp;
+
+  std::vector<std::string> sequence;
+  for (char c = 'a'; c <= 'z'; ++c)
+  {
+    sequence.emplace_back(1, c);
+  }
+
+  std::vector<std::string> expected(sequence.size());
+  std::inclusive_scan(sequence.begin(), sequence.end(), expected.begin());
+
+  std::vector<std::string> output(sequence.size());
+  algorithm::inclusive_scan(
+    wp, sequence.begin(), sequence.end(), output.begin(), std::plus<>{}, algorithm::static_partitioner{ 4 });
+  EXPECT_EQ(output, expected);
+}
+
+
+TEST(InclusiveScan, NonRandomAccess)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::list<int> sequence(1001);
+  std::iota(sequence.begin(), sequence.end(), 0);
+
+  std::list<int> expected(sequence.size());
+  std::inclusive_scan(sequence.begin(), sequence.end(), expected.begin());
+
+  std::list<int> output(sequence.size());
+  algorithm::inclusive_scan(
+    wp, sequence.begin(), sequence.end(), output.begin(), std::plus<>{}, algorithm::guided_partitioner{ 8 });
+  EXPECT_EQ(output, expected);
+}
+
+
+TEST(ExclusiveScan, EmptySequence)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  const std::vector<int> sequence = {};
+  std::vector<int> output;
+
+  EXPECT_EQ(algorithm::exclusive_scan(wp, sequence.begin(), sequence.end(), output.begin(), 0), output.end());
+}
+
+
+TEST(ExclusiveScan, SizesToOffsets)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<std::size_t> sizes(10007);
+  for (std::size_t i = 0; i < sizes.size(); ++i)
+  {
+    sizes[i] = i % 7;
+  }
+
+  std::vector<std::size_t> expected(sizes.size());
+  std::exclusive_scan(sizes.begin(), sizes.end(), expected.begin(), std::size_t{ 100 });
+
+  std::vector<std::size_t> offsets(sizes.size());
+  EXPECT_EQ(
+    algorithm::exclusive_scan(wp, sizes.begin(), sizes.end(), offsets.begin(), std::size_t{ 100 }), offsets.end());
+  EXPECT_EQ(offsets, expected);
+}
+
+
+TEST(ExclusiveScan, InPlace)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<int> sequence(10007, 1);
+
+  algorithm::exclusive_scan(
+    wp, sequence.begin(), sequence.end(), sequence.begin(), 0, std::plus<>{}, algorithm::dynamic_partitioner{ 100 });
+
+  for (std::size_t i = 0; i < sequence.size(); ++i)
+  {
+    ASSERT_EQ(sequence[i], static_cast<int>(i));
+  }
+}
+
+
+TEST(TransformInclusiveScan, FullSequence)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<int> sequence(1001);
+  std::iota(sequence.begin(), sequence.end(), 0);
+
+  const auto square = [](int v) { return static_cast<long>(v) * v; };
+
+  std::vector<long> expected(sequence.size());
+  std::transform_inclusive_scan(sequence.begin(), sequence.end(), expected.begin(), std::plus<>{}, square);
+
+  std::vector<long> output(sequence.size());
+  algorithm::transform_inclusive_scan(wp, sequence.begin(), sequence.end(), output.begin(), std::plus<>{}, square);
+  EXPECT_EQ(output, expected);
+}
+
+
+TEST(TransformInclusiveScan, FullSequenceInit)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<int> sequence(1001);
+  std::iota(sequence.begin(), sequence.end(), 0);
+
+  const auto square = [](int v) { return static_cast<long>(v) * v; };
+
+  std::vector<long> expected(sequence.size());
+  std::transform_inclusive_scan(sequence.begin(), sequence.end(), expected.begin(), std::plus<>{}, square, 3L);
+
+  std::vector<long> output(sequence.size());
+  algorithm::transform_inclusive_scan(
+    wp,
+    sequence.begin(),
+    sequence.end(),
+    output.begin(),
+    std::plus<>{},
+    square,
+    3L,
+    algorithm::guided_partitioner{ 16 });
+  EXPECT_EQ(output, expected);
+}
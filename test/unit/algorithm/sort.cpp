@@ -0,0 +1,162 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file sort.cpp
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/algorithm/sort.hpp>
+#include <parachute/pool.hpp>
+
+using namespace para;
+
+
+static std::vector<int> make_shuffled(const std::size_t n, const int modulo)
+{
+  std::mt19937 rng{ 42 };
+  std::vector<int> sequence(n);
+  for (auto& v : sequence)
+  {
+    v = static_cast<int>(rng() % static_cast<std::uint32_t>(modulo));
+  }
+  return sequence;
+}
+
+
+TEST(Sort, EmptySequence)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<int> sequence = {};
+
+  algorithm::sort(wp, sequence.begin(), sequence.end());
+
+  EXPECT_TRUE(sequence.empty());
+}
+
+
+TEST(Sort, ShortSequence)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  auto sequence = make_shuffled(1000, 100);
+  auto expected = sequence;
+  std::sort(expected.begin(), expected.end());
+
+  algorithm::sort(wp, sequence.begin(), sequence.end());
+
+  EXPECT_EQ(sequence, expected);
+}
+
+
+TEST(Sort, LongSequence)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  for (const std::size_t n : { 16385UL, 100003UL, 1000000UL })
+  {
+    auto sequence = make_shuffled(n, 1000);
+    auto expected = sequence;
+    std::sort(expected.begin(), expected.end());
+
+    algorithm::sort(wp, sequence.begin(), sequence.end());
+
+    EXPECT_EQ(sequence, expected) << "n = " << n;
+  }
+}
+
+
+TEST(Sort, LongSequenceOddWorkerCount)
+{
+  using pool_type = static_pool<3>;
+
+  pool_type wp;
+
+  auto sequence = make_shuffled(100003, 1 << 30);
+  auto expected = sequence;
+  std::sort(expected.begin(), expected.end(), std::greater<>{});
+
+  algorithm::sort(wp, sequence.begin(), sequence.end(), std::greater<>{});
+
+  EXPECT_EQ(sequence, expected);
+}
+
+
+TEST(Sort, LongSequenceDynamicPool)
+{
+  using pool_type = pool_stealing;
+
+  pool_type wp{ std::size_t{ 5 } };
+
+  auto sequence = make_shuffled(200000, 1 << 30);
+  auto expected = sequence;
+  std::sort(expected.begin(), expected.end());
+
+  algorithm::sort(wp, sequence.begin(), sequence.end());
+
+  EXPECT_EQ(sequence, expected);
+}
+
+
+TEST(Sort, MoveOnlyElements)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  const auto values = make_shuffled(50000, 1 << 30);
+  std::vector<std::unique_ptr<int>> sequence;
+  for (const int v : values)
+  {
+    sequence.push_back(std::make_unique<int>(v));
+  }
+
+  algorithm::sort(wp, sequence.begin(), sequence.end(), [](const auto& lhs, const auto& rhs) { return *lhs < *rhs; });
+
+  ASSERT_TRUE(std::all_of(sequence.begin(), sequence.end(), [](const auto& v) { return v != nullptr; }));
+  EXPECT_TRUE(std::is_sorted(sequence.begin(), sequence.end(), [](const auto& lhs, const auto& rhs) {
+    return *lhs < *rhs;
+  }));
+}
+
+
+TEST(StableSort, KeepsOrderOfEquivalentElements)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  const auto keys = make_shuffled(100003, 16);
+  std::vector<std::pair<int, std::size_t>> sequence;
+  for (std::size_t i = 0; i < keys.size(); ++i)
+  {
+    sequence.emplace_back(keys[i], i);
+  }
+  auto expected = sequence;
+
+  const auto by_key = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+  std::stable_sort(expected.begin(), expected.end(), by_key);
+
+  algorithm::stable_sort(wp, sequence.begin(), sequence.end(), by_key);
+
+  EXPECT_EQ(sequence, expected);
+}
@@ -6,6 +6,10 @@
 
 // C++ Standard Library
 #include <algorithm>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <sstream>
 #include <vector>
 
 // GTest
@@ -135,3 +139,168 @@ TEST(TransformOrdered, UndersizedOupoutSequence)
 
   EXPECT_NE(transformed_sequence, expected_sequence);
 }
+
+
+TEST(TransformUnordered, FullSequenceDynamicPartitioner)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<double> original_sequence(1001);
+  std::iota(original_sequence.begin(), original_sequence.end(), 0.0);
+
+  std::vector<double> expected_sequence = original_sequence;
+  std::for_each(expected_sequence.begin(), expected_sequence.end(), [](double& v) { v *= 2; });
+
+  std::vector<double> transformed_sequence;
+  algorithm::transform(
+    wp,
+    original_sequence.begin(),
+    original_sequence.end(),
+    std::back_inserter(transformed_sequence),
+    [](double v) { return v * 2; },
+    algorithm::dynamic_partitioner{ 16 });
+
+  std::sort(transformed_sequence.begin(), transformed_sequence.end());
+  EXPECT_EQ(transformed_sequence, expected_sequence);
+}
+
+
+TEST(TransformOrdered, FullSequenceGuidedPartitioner)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<double> original_sequence(1001);
+  std::iota(original_sequence.begin(), original_sequence.end(), 0.0);
+
+  std::vector<double> expected_sequence = original_sequence;
+  std::for_each(expected_sequence.begin(), expected_sequence.end(), [](double& v) { v *= 2; });
+
+  std::vector<double> transformed_sequence;
+  transformed_sequence.resize(original_sequence.size());
+  algorithm::transform(
+    wp,
+    original_sequence.begin(),
+    original_sequence.end(),
+    transformed_sequence.begin(),
+    transformed_sequence.end(),
+    [](double v) { return v * 2; },
+    algorithm::guided_partitioner{ 8 });
+
+  EXPECT_EQ(transformed_sequence, expected_sequence);
+}
+
+
+TEST(TransformOrdered, FullSequenceNonRandomAccess)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::list<double> original_sequence(1001);
+  std::iota(original_sequence.begin(), original_sequence.end(), 0.0);
+
+  std::list<double> expected_sequence = original_sequence;
+  std::for_each(expected_sequence.begin(), expected_sequence.end(), [](double& v) { v *= 2; });
+
+  std::list<double> transformed_sequence;
+  transformed_sequence.resize(original_sequence.size());
+  algorithm::transform(
+    wp,
+    original_sequence.begin(),
+    original_sequence.end(),
+    transformed_sequence.begin(),
+    transformed_sequence.end(),
+    [](double v) { return v * 2; },
+    algorithm::static_partitioner{ 100 });
+
+  EXPECT_EQ(transformed_sequence, expected_sequence);
+}
+
+
+TEST(TransformOutputIterator, BackInserterPreservesOrder)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<double> original_sequence(1001);
+  std::iota(original_sequence.begin(), original_sequence.end(), 0.0);
+
+  std::vector<double> expected_sequence = { -1.0 };
+  std::transform(
+    original_sequence.begin(), original_sequence.end(), std::back_inserter(expected_sequence), [](double v) {
+      return v * 2;
+    });
+
+  std::vector<double> transformed_sequence = { -1.0 };
+  algorithm::transform(
+    wp,
+    original_sequence.begin(),
+    original_sequence.end(),
+    std::back_inserter(transformed_sequence),
+    [](double v) { return v * 2; },
+    algorithm::dynamic_partitioner{ 16 });
+
+  EXPECT_EQ(transformed_sequence, expected_sequence);
+}
+
+
+TEST(TransformOutputIterator, ListBackInserterPreservesOrder)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::list<double> original_sequence(1001);
+  std::iota(original_sequence.begin(), original_sequence.end(), 0.0);
+
+  std::list<double> expected_sequence;
+  std::transform(
+    original_sequence.begin(), original_sequence.end(), std::back_inserter(expected_sequence), [](double v) {
+      return v * 2;
+    });
+
+  std::list<double> transformed_sequence;
+  algorithm::transform(
+    wp,
+    original_sequence.begin(),
+    original_sequence.end(),
+    std::back_inserter(transformed_sequence),
+    [](double v) { return v * 2; },
+    algorithm::guided_partitioner{ 8 });
+
+  EXPECT_EQ(transformed_sequence, expected_sequence);
+}
+
+
+TEST(TransformOutputIterator, StreamPreservesOrder)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<int> original_sequence(1001);
+  std::iota(original_sequence.begin(), original_sequence.end(), 0);
+
+  std::ostringstream expected_stream;
+  std::transform(
+    original_sequence.begin(),
+    original_sequence.end(),
+    std::ostream_iterator<int>{ expected_stream, "," },
+    [](int v) { return v * 2; });
+
+  std::ostringstream transformed_stream;
+  algorithm::transform(
+    wp,
+    original_sequence.begin(),
+    original_sequence.end(),
+    std::ostream_iterator<int>{ transformed_stream, "," },
+    [](int v) { return v * 2; },
+    algorithm::static_partitioner{ 100 });
+
+  EXPECT_EQ(transformed_stream.str(), expected_stream.str());
+}
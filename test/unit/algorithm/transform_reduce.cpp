@@ -0,0 +1,61 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file transform_reduce.cpp
+ */
+
+// C++ Standard Library
+#include <functional>
+#include <numeric>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/algorithm/transform_reduce.hpp>
+#include <parachute/pool.hpp>
+
+using namespace para;
+
+
+TEST(TransformReduce, EmptySequence)
+{
+  using pool_type = worker;
+
+  pool_type wp;
+
+  const std::vector<int> sequence = {};
+
+  EXPECT_EQ(
+    algorithm::transform_reduce(wp, sequence.begin(), sequence.end(), 5, std::plus<>{}, [](int v) { return v * v; }),
+    5);
+}
+
+
+TEST(TransformReduce, FullSequence)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::vector<int> sequence(1001);
+  std::iota(sequence.begin(), sequence.end(), 0);
+
+  long expected = 0;
+  for (const int v : sequence)
+  {
+    expected += static_cast<long>(v) * v;
+  }
+
+  EXPECT_EQ(
+    algorithm::transform_reduce(
+      wp,
+      sequence.begin(),
+      sequence.end(),
+      0L,
+      std::plus<>{},
+      [](int v) { return static_cast<long>(v) * v; },
+      algorithm::dynamic_partitioner{ 32 }),
+    expected);
+}
@@ -0,0 +1,144 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file coroutine.cpp
+ */
+
+// Parachute
+#include <parachute/coroutine.hpp>
+
+#if defined(__cpp_impl_coroutine)
+
+// C++ Standard Library
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/non_blocking_future.hpp>
+#include <parachute/pool.hpp>
+#include <parachute/post.hpp>
+
+using namespace para;
+
+
+static coro::task<int> answer() { co_return 42; }
+
+
+static coro::task<int> add_one(coro::task<int> t) { co_return co_await std::move(t) + 1; }
+
+
+static coro::task<void> fail()
+{
+  throw std::runtime_error{ "error" };
+  co_return;
+}
+
+
+TEST(Coroutine, TaskIsLazy)
+{
+  bool started = false;
+  auto t = [](bool& started) -> coro::task<void> {
+    started = true;
+    co_return;
+  }(started);
+  EXPECT_FALSE(started);
+
+  auto future = coro::start(std::move(t));
+  EXPECT_TRUE(started);
+  EXPECT_TRUE(future.valid());
+}
+
+
+TEST(Coroutine, AwaitTask)
+{
+  auto future = coro::start(add_one(answer()));
+  ASSERT_TRUE(future.valid());
+  EXPECT_EQ(future.get(), 43);
+}
+
+
+TEST(Coroutine, AwaitTaskException)
+{
+  auto future = coro::start([]() -> coro::task<void> { co_await fail(); }());
+  ASSERT_TRUE(future.valid());
+  EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+
+TEST(Coroutine, ScheduleOnPool)
+{
+  pool_strict wp{ 2UL };
+
+  const auto caller = std::this_thread::get_id();
+  auto future = coro::start([](pool_strict& wp) -> coro::task<std::thread::id> {
+    co_await schedule_on(wp);
+    co_return std::this_thread::get_id();
+  }(wp));
+
+  future.wait();
+  EXPECT_NE(future.get(), caller);
+}
+
+
+TEST(Coroutine, AwaitFuture)
+{
+  pool_strict wp{ 2UL };
+
+  auto future = coro::start([](pool_strict& wp) -> coro::task<int> {
+    const int a = co_await post<strategy::non_blocking>(wp, [] { return 1; });
+    const int b = co_await post<strategy::non_blocking>(wp, [] { return 2; });
+    co_return a + b;
+  }(wp));
+
+  future.wait();
+  EXPECT_EQ(future.get(), 3);
+}
+
+
+TEST(Coroutine, AwaitFutureException)
+{
+  pool_strict wp{ 2UL };
+
+  auto future = coro::start([](pool_strict& wp) -> coro::task<void> {
+    co_await post<strategy::non_blocking>(wp, [] { throw std::runtime_error{ "error" }; });
+  }(wp));
+
+  future.wait();
+  EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+
+TEST(Coroutine, ManyInFlight)
+{
+  pool_strict wp{ 2UL };
+
+  // Each coroutine suspends on a promise which is set later; none holds a thread while it waits
+  constexpr int n = 10000;
+  std::vector<non_blocking_promise<int>> promises(n);
+  std::vector<non_blocking_future<int>> results;
+  results.reserve(n);
+  for (auto& p : promises)
+  {
+    results.push_back(coro::start([](non_blocking_future<int> f) -> coro::task<int> {
+      co_return co_await std::move(f) * 2;
+    }(p.get_future())));
+  }
+
+  for (int i = 0; i < n; ++i)
+  {
+    wp.emplace([&promises, i] { promises[static_cast<std::size_t>(i)].set_value(int{ i }); });
+  }
+
+  for (int i = 0; i < n; ++i)
+  {
+    results[static_cast<std::size_t>(i)].wait();
+    ASSERT_EQ(results[static_cast<std::size_t>(i)].get(), 2 * i);
+  }
+}
+
+#endif  // defined(__cpp_impl_coroutine)
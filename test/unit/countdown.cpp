@@ -0,0 +1,82 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file countdown.cpp
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/idle_policy.hpp>
+#include <parachute/utility/countdown.hpp>
+
+using namespace para;
+
+
+TEST(Countdown, ZeroDoesNotBlock)
+{
+  utility::countdown c{ 0 };
+  EXPECT_FALSE(c.valid());
+  c.wait();
+}
+
+
+TEST(Countdown, WaitsForAllDecrements)
+{
+  constexpr int n_threads = 4;
+  constexpr int n_per_thread = 1000;
+
+  utility::countdown c{ n_threads * n_per_thread };
+  std::atomic<int> done = 0;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < n_threads; ++t)
+  {
+    threads.emplace_back([&c, &done] {
+      for (int i = 0; i < n_per_thread; ++i)
+      {
+        done.fetch_add(1, std::memory_order_relaxed);
+        --c;
+      }
+    });
+  }
+
+  c.wait();
+  EXPECT_EQ(done.load(std::memory_order_relaxed), n_threads * n_per_thread);
+  EXPECT_FALSE(c.valid());
+
+  for (auto& t : threads)
+  {
+    t.join();
+  }
+}
+
+
+TEST(Countdown, WaitSpinning)
+{
+  utility::countdown c{ 1 };
+  int value = 0;
+  std::thread t{ [&c, &value] { c.decrement([&value] { value = 1; }); } };
+  c.wait<idle_spin<>>();
+  EXPECT_EQ(value, 1);
+  t.join();
+}
+
+
+TEST(Countdown, WaitHelping)
+{
+  utility::countdown c{ 3 };
+  int calls = 0;
+  c.wait([&c, &calls] {
+    ++calls;
+    --c;
+    return true;
+  });
+  EXPECT_EQ(calls, 3);
+}
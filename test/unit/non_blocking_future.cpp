@@ -0,0 +1,264 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file non_blocking_future.cpp
+ */
+
+// C++ Standard Library
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/non_blocking_future.hpp>
+
+using namespace para;
+
+
+TEST(NonBlockingFuture, ValidAfterSetValue)
+{
+  non_blocking_promise<int> promise;
+  auto future = promise.get_future();
+
+  EXPECT_FALSE(future.valid());
+  promise.set_value(3);
+  EXPECT_TRUE(future.valid());
+  EXPECT_EQ(future.get(), 3);
+  EXPECT_FALSE(future.valid());
+}
+
+
+TEST(NonBlockingFuture, GetBeforeReadyThrows)
+{
+  non_blocking_promise<int> promise;
+  auto future = promise.get_future();
+
+  EXPECT_THROW(future.get(), non_blocking_future_error);
+}
+
+
+TEST(NonBlockingFuture, GetTwiceThrows)
+{
+  non_blocking_promise<void> promise;
+  auto future = promise.get_future();
+
+  promise.set_value();
+  future.get();
+  EXPECT_THROW(future.get(), non_blocking_future_error);
+}
+
+
+TEST(NonBlockingFuture, SetTwiceThrows)
+{
+  non_blocking_promise<int> promise;
+  auto future = promise.get_future();
+
+  promise.set_value(1);
+  EXPECT_THROW(promise.set_value(2), non_blocking_future_error);
+  EXPECT_THROW(promise.set_exception(std::make_exception_ptr(std::runtime_error{ "" })), non_blocking_future_error);
+  EXPECT_EQ(future.get(), 1);
+}
+
+
+TEST(NonBlockingFuture, GetFutureTwiceThrows)
+{
+  non_blocking_promise<int> promise;
+  auto future = promise.get_future();
+
+  EXPECT_THROW(promise.get_future(), non_blocking_future_error);
+}
+
+
+TEST(NonBlockingFuture, ExceptionIsValidAndRethrown)
+{
+  non_blocking_promise<int> promise;
+  auto future = promise.get_future();
+
+  promise.set_exception(std::make_exception_ptr(std::runtime_error{ "error" }));
+  EXPECT_TRUE(future.valid());
+  EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+
+TEST(NonBlockingFuture, BrokenPromise)
+{
+  auto promise = std::make_unique<non_blocking_promise<int>>();
+  auto future = promise->get_future();
+
+  promise.reset();
+  future.wait();
+
+  try
+  {
+    future.get();
+    FAIL() << "expected non_blocking_future_error";
+  }
+  catch (const non_blocking_future_error& error)
+  {
+    EXPECT_EQ(error.error, non_blocking_future_errc::broken_promise);
+  }
+}
+
+
+TEST(NonBlockingFuture, FutureDestroyedBeforeValueIsSet)
+{
+  non_blocking_promise<std::vector<int>> promise;
+  {
+    auto future = promise.get_future();
+  }
+  promise.set_value(std::vector<int>(10));
+}
+
+
+TEST(NonBlockingFuture, WaitForTimesOut)
+{
+  non_blocking_promise<int> promise;
+  auto future = promise.get_future();
+
+  EXPECT_FALSE(future.wait_for(std::chrono::milliseconds(5)));
+  EXPECT_FALSE(future.wait_until(std::chrono::steady_clock::now() + std::chrono::milliseconds(5)));
+  promise.set_value(1);
+  EXPECT_TRUE(future.wait_for(std::chrono::milliseconds(5)));
+}
+
+
+TEST(NonBlockingFuture, WaitFromOtherThread)
+{
+  for (int i = 0; i < 100; ++i)
+  {
+    non_blocking_promise<int> promise;
+    auto future = promise.get_future();
+
+    std::thread setter{ [&promise, i] {
+      if (i % 2 == 0)
+      {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+      }
+      promise.set_value(int{ i });
+    } };
+
+    future.wait();
+    EXPECT_TRUE(future.valid());
+    EXPECT_EQ(future.get(), i);
+    setter.join();
+  }
+}
+
+
+TEST(NonBlockingFuture, WaitForFromOtherThread)
+{
+  non_blocking_promise<void> promise;
+  auto future = promise.get_future();
+
+  std::thread setter{ [&promise] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    promise.set_value();
+  } };
+
+  EXPECT_TRUE(future.wait_for(std::chrono::seconds(10)));
+  future.get();
+  setter.join();
+}
+
+
+TEST(NonBlockingFuture, ThenInlineAfterValueIsSet)
+{
+  non_blocking_promise<int> promise;
+  auto future = promise.get_future();
+
+  promise.set_value(2);
+
+  auto next = future.then([](int v) { return v * 3; });
+  ASSERT_TRUE(next.valid());
+  EXPECT_EQ(next.get(), 6);
+}
+
+
+TEST(NonBlockingFuture, ThenInlineBeforeValueIsSet)
+{
+  non_blocking_promise<int> promise;
+  auto future = promise.get_future();
+
+  auto next = future.then([](int v) { return std::to_string(v); }).then([](std::string s) { return s + "!"; });
+  EXPECT_FALSE(next.valid());
+
+  promise.set_value(2);
+  ASSERT_TRUE(next.valid());
+  EXPECT_EQ(next.get(), "2!");
+}
+
+
+TEST(NonBlockingFuture, ThenVoid)
+{
+  non_blocking_promise<void> promise;
+  auto future = promise.get_future();
+
+  int calls = 0;
+  auto next = future.then([&calls] { ++calls; }).then([&calls] { return calls; });
+
+  promise.set_value();
+  ASSERT_TRUE(next.valid());
+  EXPECT_EQ(next.get(), 1);
+}
+
+
+TEST(NonBlockingFuture, ThenPropagatesException)
+{
+  non_blocking_promise<int> promise;
+  auto future = promise.get_future();
+
+  bool called = false;
+  auto next = future.then([&called](int v) {
+                      called = true;
+                      return v;
+                    })
+                .then([](int v) { return v + 1; });
+
+  promise.set_exception(std::make_exception_ptr(std::runtime_error{ "error" }));
+  ASSERT_TRUE(next.valid());
+  EXPECT_THROW(next.get(), std::runtime_error);
+  EXPECT_FALSE(called);
+}
+
+
+TEST(NonBlockingFuture, ThenPropagatesThrownException)
+{
+  non_blocking_promise<int> promise;
+  auto future = promise.get_future();
+
+  auto next = future.then([](int) -> int { throw std::logic_error{ "error" }; }).then([](int v) { return v; });
+
+  promise.set_value(1);
+  ASSERT_TRUE(next.valid());
+  EXPECT_THROW(next.get(), std::logic_error);
+}
+
+
+TEST(NonBlockingFuture, ThenBrokenPromise)
+{
+  auto promise = std::make_unique<non_blocking_promise<int>>();
+  auto next = promise->get_future().then([](int v) { return v; });
+
+  promise.reset();
+  ASSERT_TRUE(next.valid());
+  EXPECT_THROW(next.get(), non_blocking_future_error);
+}
+
+
+TEST(NonBlockingFuture, ThenMoveOnlyValue)
+{
+  non_blocking_promise<std::unique_ptr<int>> promise;
+  auto future = promise.get_future();
+
+  auto next = future.then([](std::unique_ptr<int> v) { return *v; });
+
+  promise.set_value(std::make_unique<int>(4));
+  ASSERT_TRUE(next.valid());
+  EXPECT_EQ(next.get(), 4);
+}
@@ -5,8 +5,13 @@
  */
 
 // C++ Standard Library
+#include <atomic>
 #include <chrono>
+#include <functional>
 #include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
 #include <thread>
 
 // GTest
@@ -26,10 +31,45 @@ public:
 };
 
 using PoolTestSuiteTypes =
-  ::testing::Types<worker, worker_strict, static_pool<4>, static_pool_strict<4>, pool, pool_strict>;
+  ::testing::Types<
+    worker,
+    worker_strict,
+    static_pool<4>,
+    static_pool_strict<4>,
+    pool,
+    pool_strict,
+    pool_stealing,
+    pool_stealing_strict,
+    pool_priority,
+    pool_priority_strict,
+    pool_pinned,
+    pool_pinned_strict,
+    pool_spinning,
+    pool_spinning_strict,
+    pool_base<work_group_dynamic, work_queue_stealing<>, work_control_idle<idle_spin<>>>,
+    pool_elastic,
+    pool_elastic_strict,
+    pool_base<work_group_elastic, work_queue_stealing<>, work_control_strict>,
+    pool_instrumented,
+    pool_instrumented_strict,
+    pool_base<work_group_dynamic, work_queue_stealing<>, work_control_stats<work_control_idle<idle_spin<>>>>,
+    pool_traced,
+    pool_traced_strict,
+    pool_base<work_group_dynamic, work_queue_stealing<>, work_control_trace<work_control_stats<work_control_strict>>>,
+    pool_base<work_group_dynamic, work_queue_ring<256>, work_control_default>,
+    pool_base<work_group_dynamic, work_queue_ring<256>, work_control_strict>,
+    pool_base<work_group_dynamic, work_queue_lifo<std::function<void()>>, work_control_default>,
+    pool_base<work_group_dynamic, work_queue_lifo<std::function<void()>>, work_control_strict>>;
 
 TYPED_TEST_SUITE(PoolTestSuite, PoolTestSuiteTypes);
 
+/// Checks if a pool can hold move-only work; pools which store work as std::function cannot
+template <typename PoolT> struct HoldsMoveOnlyWork;
+
+template <typename WorkGroupT, typename WorkQueueT, typename WorkControlT>
+struct HoldsMoveOnlyWork<pool_base<WorkGroupT, WorkQueueT, WorkControlT>> : detail::holds_move_only_work<WorkQueueT>
+{};
+
 TYPED_TEST(PoolTestSuite, EmplaceAndDtor)
 {
   using pool_type = TypeParam;
@@ -47,49 +87,286 @@ TYPED_TEST(PoolTestSuite, Post)
 
   auto tracker = post<strategy::non_blocking>(wp, [] { return 1; });
 
-  while (true)
-  {
-    if (tracker.valid())
-    {
-      ASSERT_EQ(tracker.get(), 1);
-      break;
-    }
-    else
+  tracker.wait();
+  ASSERT_TRUE(tracker.valid());
+  ASSERT_EQ(tracker.get(), 1);
+}
+
+TYPED_TEST(PoolTestSuite, PostVoid)
+{
+  using pool_type = TypeParam;
+
+  pool_type wp;
+
+  auto tracker = post<strategy::non_blocking>(wp, [] {});
+
+  tracker.wait();
+  ASSERT_TRUE(tracker.valid());
+  tracker.get();
+}
+
+TYPED_TEST(PoolTestSuite, PostBlocking)
+{
+  using pool_type = TypeParam;
+
+  pool_type wp;
+
+  auto tracker = post(wp, [] { return 1; });
+
+  ASSERT_EQ(tracker.get(), 1);
+}
+
+TYPED_TEST(PoolTestSuite, EmplaceFromWorker)
+{
+  using pool_type = TypeParam;
+
+  pool_type wp;
+
+  static constexpr int kFanOut = 100;
+  std::atomic<int> completed = 0;
+
+  auto tracker = post(wp, [&wp, &completed] {
+    for (int i = 0; i < kFanOut; ++i)
     {
-      ::std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      wp.emplace([&completed] { ++completed; });
     }
+  });
+  tracker.get();
+
+  while (completed.load() < kFanOut)
+  {
+    ::std::this_thread::sleep_for(std::chrono::milliseconds(1));
   }
+
+  ASSERT_EQ(completed.load(), kFanOut);
 }
 
-TYPED_TEST(PoolTestSuite, PostVoid)
+TYPED_TEST(PoolTestSuite, PostMoveOnlyCapture)
+{
+  using pool_type = TypeParam;
+
+  if constexpr (!HoldsMoveOnlyWork<pool_type>::value)
+  {
+    GTEST_SKIP() << "work storage is copy-only";
+  }
+  else
+  {
+    pool_type wp;
+
+    auto tracker = post(wp, [p = std::make_unique<int>(1)] { return *p; });
+
+    ASSERT_EQ(tracker.get(), 1);
+  }
+}
+
+TYPED_TEST(PoolTestSuite, EmplaceBulk)
 {
   using pool_type = TypeParam;
 
   pool_type wp;
 
-  auto tracker = post<strategy::non_blocking>(wp, [] {});
+  static constexpr int kCount = 100;
+  std::atomic<int> completed = 0;
 
-  while (true)
+  std::vector<std::function<void()>> work(kCount, [&completed] { ++completed; });
+  wp.emplace_bulk(work.begin(), work.end());
+  wp.emplace_n(kCount, [&completed](std::size_t) { return [&completed] { ++completed; }; });
+
+  while (completed.load() < 2 * kCount)
   {
-    if (tracker.valid())
+    ::std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  ASSERT_EQ(completed.load(), 2 * kCount);
+}
+
+TYPED_TEST(PoolTestSuite, PostBulk)
+{
+  using pool_type = TypeParam;
+
+  pool_type wp;
+
+  std::vector<std::function<int()>> work;
+  for (int i = 0; i < 10; ++i)
+  {
+    work.emplace_back([i] { return i; });
+  }
+
+  auto trackers = post_bulk(wp, work.begin(), work.end());
+  ASSERT_EQ(trackers.size(), work.size());
+
+  for (int i = 0; i < 10; ++i)
+  {
+    ASSERT_EQ(trackers[i].get(), i);
+  }
+}
+
+TYPED_TEST(PoolTestSuite, PostBulkNonBlocking)
+{
+  using pool_type = TypeParam;
+
+  pool_type wp;
+
+  std::vector<std::function<void()>> work(10, [] {});
+
+  auto trackers = post_bulk<strategy::non_blocking>(wp, work.begin(), work.end());
+  ASSERT_EQ(trackers.size(), work.size());
+
+  for (auto& tracker : trackers)
+  {
+    tracker.wait();
+    tracker.get();
+  }
+}
+
+TYPED_TEST(PoolTestSuite, PostThen)
+{
+  using pool_type = TypeParam;
+
+  if constexpr (!HoldsMoveOnlyWork<pool_type>::value)
+  {
+    GTEST_SKIP() << "work storage is copy-only";
+  }
+  else
+  {
+    pool_type wp;
+
+    auto tracker = post<strategy::non_blocking>(wp, [] { return 1; })
+                     .then(wp, [](int v) { return v + 1; })
+                     .then(wp, [](int v) { return std::vector<int>(static_cast<std::size_t>(v), v); });
+
+    tracker.wait();
+    ASSERT_EQ(tracker.get(), std::vector<int>({ 2, 2 }));
+  }
+}
+
+TYPED_TEST(PoolTestSuite, PostThenException)
+{
+  using pool_type = TypeParam;
+
+  if constexpr (!HoldsMoveOnlyWork<pool_type>::value)
+  {
+    GTEST_SKIP() << "work storage is copy-only";
+  }
+  else
+  {
+    pool_type wp;
+
+    auto tracker = post<strategy::non_blocking>(wp, []() -> int { throw std::runtime_error{ "error" }; })
+                     .then(wp, [](int v) { return v + 1; });
+
+    tracker.wait();
+    ASSERT_THROW(tracker.get(), std::runtime_error);
+  }
+}
+
+TYPED_TEST(PoolTestSuite, WaitHelpingFromWorker)
+{
+  using pool_type = TypeParam;
+
+  pool_type wp;
+
+  // Each outer job waits on inner jobs from the same pool, which needs every waiting worker to help run them
+  std::vector<non_blocking_future<int>> outer;
+  for (int i = 0; i < 8; ++i)
+  {
+    outer.push_back(post<strategy::non_blocking>(wp, [&wp, i] {
+      auto inner = post<strategy::non_blocking>(wp, [i] { return i; });
+      inner.wait([&wp] { return wp.try_run_one(); });
+      return inner.get() + 1;
+    }));
+  }
+
+  for (int i = 0; i < 8; ++i)
+  {
+    outer[static_cast<std::size_t>(i)].wait([&wp] { return wp.try_run_one(); });
+    ASSERT_EQ(outer[static_cast<std::size_t>(i)].get(), i + 1);
+  }
+}
+
+TEST(Pool, PostBulkDroppedWorkBreaksPromises)
+{
+  std::atomic<bool> started = false;
+  std::atomic<bool> released = false;
+  std::vector<std::future<int>> blocking;
+  std::vector<non_blocking_future<int>> non_blocking;
+  {
+    worker wp;
+    wp.emplace([&] {
+      started = true;
+      while (!released)
+      {
+        std::this_thread::yield();
+      }
+    });
+    while (!started)
+    {
+      std::this_thread::yield();
+    }
+
+    std::vector<std::function<int()>> work(3, [] { return 1; });
+    blocking = post_bulk(wp, work.begin(), work.end());
+    non_blocking = post_bulk<strategy::non_blocking>(wp, work.begin(), work.end());
+    released = true;
+
+    // Pool which does not finish all work drops work still queued on destruction
+  }
+
+  for (auto& f : blocking)
+  {
+    ASSERT_EQ(f.wait_for(std::chrono::seconds{ 1 }), std::future_status::ready);
+    try
     {
-      tracker.get();
-      break;
+      f.get();
+      FAIL() << "expected broken promise";
     }
-    else
+    catch (const std::future_error& error)
     {
-      ::std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      EXPECT_EQ(error.code(), std::future_errc::broken_promise);
+    }
+  }
+  for (auto& f : non_blocking)
+  {
+    ASSERT_TRUE(f.wait_for(std::chrono::seconds{ 1 }));
+    try
+    {
+      f.get();
+      FAIL() << "expected broken promise";
+    }
+    catch (const non_blocking_future_error& error)
+    {
+      EXPECT_EQ(error.error, non_blocking_future_errc::broken_promise);
     }
   }
 }
 
-TYPED_TEST(PoolTestSuite, PostBlocking)
+TEST(Pool, PostBulkThrowingWork)
 {
-  using pool_type = TypeParam;
+  // Throws when copied into its task, after some work has already been generated
+  struct throwing_work
+  {
+    int index;
+    std::shared_ptr<std::atomic<int>> copies;
 
-  pool_type wp;
+    throwing_work(const int i, std::shared_ptr<std::atomic<int>> c) : index{ i }, copies{ std::move(c) } {}
+    throwing_work(const throwing_work& other) : index{ other.index }, copies{ other.copies }
+    {
+      if (copies->fetch_add(1) == 2)
+      {
+        throw std::runtime_error{ "copy" };
+      }
+    }
+    int operator()() const { return index; }
+  };
 
-  auto tracker = post(wp, [] { return 1; });
+  auto copies = std::make_shared<std::atomic<int>>(-100);
+  std::vector<throwing_work> work;
+  for (int i = 0; i < 5; ++i)
+  {
+    work.emplace_back(i, copies);
+  }
+  copies->store(0);
 
-  ASSERT_EQ(tracker.get(), 1);
+  pool_strict wp{ 2UL };
+  EXPECT_THROW((void)post_bulk(wp, work.begin(), work.end()), std::runtime_error);
 }
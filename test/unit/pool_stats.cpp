@@ -0,0 +1,142 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file pool_stats.cpp
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/pool.hpp>
+#include <parachute/stats_policy.hpp>
+
+using namespace para;
+
+
+TEST(PoolStats, LatencyBucket)
+{
+  EXPECT_EQ(detail::latency_bucket(0), 0UL);
+  EXPECT_EQ(detail::latency_bucket(1), 1UL);
+  EXPECT_EQ(detail::latency_bucket(2), 2UL);
+  EXPECT_EQ(detail::latency_bucket(3), 2UL);
+  EXPECT_EQ(detail::latency_bucket(1024), 11UL);
+  EXPECT_EQ(detail::latency_bucket(~std::uint64_t{ 0 }), latency_bucket_count - 1);
+}
+
+
+TEST(PoolStats, LatencyQuantile)
+{
+  worker_stats stats;
+  EXPECT_EQ(stats.latency_quantile_ns(0.5), 0UL);
+
+  stats.latency_histogram[4] = 90;
+  stats.latency_histogram[10] = 10;
+  EXPECT_EQ(stats.tasks_started(), 100UL);
+  EXPECT_EQ(stats.latency_quantile_ns(0.5), 16UL);
+  EXPECT_EQ(stats.latency_quantile_ns(0.95), 1024UL);
+}
+
+
+TEST(PoolStats, CountsWork)
+{
+  constexpr int n = 100;
+  std::atomic<int> done = 0;
+
+  pool_instrumented_strict wp{ 2UL };
+  for (int i = 0; i < n; ++i)
+  {
+    wp.emplace([&done] {
+      std::this_thread::sleep_for(std::chrono::microseconds{ 10 });
+      ++done;
+    });
+  }
+  while (done.load() < n)
+  {
+    std::this_thread::yield();
+  }
+
+  // Counters are updated just after each job finishes
+  pool_stats stats = wp.stats();
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{ 10 };
+  while (stats.total.tasks_run < n and std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::yield();
+    stats = wp.stats();
+  }
+
+  EXPECT_EQ(stats.workers.size(), 2UL);
+  EXPECT_EQ(stats.enqueued, static_cast<std::uint64_t>(n));
+  EXPECT_EQ(stats.queued, 0UL);
+  EXPECT_EQ(stats.total.tasks_run, static_cast<std::uint64_t>(n));
+  EXPECT_EQ(stats.total.tasks_started(), static_cast<std::uint64_t>(n));
+  EXPECT_GE(stats.total.busy_ns, static_cast<std::uint64_t>(n) * 10'000);
+  EXPECT_GT(stats.total.latency_quantile_ns(0.99), 0UL);
+
+  std::uint64_t tasks_run = 0;
+  for (const auto& worker : stats.workers)
+  {
+    tasks_run += worker.tasks_run;
+  }
+  EXPECT_EQ(tasks_run + stats.external.tasks_run, stats.total.tasks_run);
+}
+
+
+TEST(PoolStats, CountsParksAndIdleTime)
+{
+  pool_instrumented wp{ 1UL };
+
+  // Worker parks once it finds no work, and is woken by each job enqueued while it is parked
+  for (int i = 0; i < 3; ++i)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 10 });
+    std::atomic<bool> done = false;
+    wp.emplace([&done] { done = true; });
+    while (!done.load())
+    {
+      std::this_thread::yield();
+    }
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds{ 10 });
+
+  const auto stats = wp.stats();
+  EXPECT_GE(stats.total.parks, 3UL);
+  EXPECT_GE(stats.total.wakeups, 3UL);
+  EXPECT_GE(stats.total.idle_ns, 20'000'000UL);
+}
+
+
+TEST(PoolStats, CountsExternalHelpers)
+{
+  worker_stats external;
+  {
+    pool_base<work_group_static<1>, work_queue_lifo<>, work_control_stats<>> wp;
+
+    // Keep the only worker busy, so that the calling thread runs the next job itself
+    std::atomic<bool> release = false;
+    std::atomic<bool> started = false;
+    wp.emplace([&] {
+      started = true;
+      while (!release.load())
+      {
+        std::this_thread::yield();
+      }
+    });
+    while (!started.load())
+    {
+      std::this_thread::yield();
+    }
+
+    wp.emplace([] {});
+    EXPECT_TRUE(wp.try_run_one());
+    external = wp.stats().external;
+    release = true;
+  }
+  EXPECT_EQ(external.tasks_run, 1UL);
+  EXPECT_EQ(external.tasks_started(), 1UL);
+}
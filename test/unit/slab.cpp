@@ -0,0 +1,83 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file slab.cpp
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/utility/slab.hpp>
+
+using namespace para::utility;
+
+
+TEST(Slab, ReusesFreedBlock)
+{
+  using slab_type = slab<24, 8>;
+
+  void* const first = slab_type::allocate();
+  slab_type::deallocate(first);
+  void* const second = slab_type::allocate();
+  EXPECT_EQ(first, second);
+  slab_type::deallocate(second);
+}
+
+
+TEST(Slab, BlocksAreAligned)
+{
+  using slab_type = slab<40, 64>;
+
+  std::vector<void*> blocks;
+  for (int i = 0; i < 100; ++i)
+  {
+    blocks.push_back(slab_type::allocate());
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(blocks.back()) % 64, 0UL);
+  }
+  for (void* const block : blocks)
+  {
+    slab_type::deallocate(block);
+  }
+}
+
+
+TEST(Slab, FreedOnOtherThread)
+{
+  using slab_type = slab<32, 8, 4>;
+
+  std::vector<void*> blocks;
+  for (int i = 0; i < 100; ++i)
+  {
+    blocks.push_back(slab_type::allocate());
+  }
+
+  // Blocks past the other thread's cache go to the shared depot, and the rest go there when the thread exits
+  std::thread{ [&blocks] {
+    for (void* const block : blocks)
+    {
+      slab_type::deallocate(block);
+    }
+  } }.join();
+
+  for (int i = 0; i < 100; ++i)
+  {
+    void* const block = slab_type::allocate();
+    EXPECT_NE(std::find(blocks.begin(), blocks.end(), block), blocks.end());
+    slab_type::deallocate(block);
+  }
+}
+
+
+TEST(SlabAllocator, SharedPtr)
+{
+  auto value = std::allocate_shared<int>(slab_allocator<int>{}, 5);
+  EXPECT_EQ(*value, 5);
+}
@@ -0,0 +1,85 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file task.cpp
+ */
+
+// C++ Standard Library
+#include <array>
+#include <memory>
+#include <utility>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/task.hpp>
+
+using namespace para;
+
+
+TEST(Task, DefaultEmpty)
+{
+  task t;
+  EXPECT_FALSE(t.valid());
+}
+
+
+TEST(Task, InvokeInline)
+{
+  int calls = 0;
+  auto fn = [&calls] { ++calls; };
+  static_assert(task::is_inline_v<decltype(fn)>);
+
+  task t{ fn };
+  ASSERT_TRUE(t.valid());
+
+  t();
+  t();
+  EXPECT_EQ(calls, 2);
+}
+
+
+TEST(Task, InvokeHeap)
+{
+  int calls = 0;
+  std::array<char, 128> padding{};
+  auto fn = [&calls, padding] { calls += 1 + padding[0]; };
+  static_assert(!task::is_inline_v<decltype(fn)>);
+
+  task t{ fn };
+  ASSERT_TRUE(t.valid());
+
+  t();
+  EXPECT_EQ(calls, 1);
+}
+
+
+TEST(Task, MoveOnlyCapture)
+{
+  int value = 0;
+  task t{ [&value, p = std::make_unique<int>(5)] { value = *p; } };
+
+  task moved{ std::move(t) };
+  EXPECT_FALSE(t.valid());
+  ASSERT_TRUE(moved.valid());
+
+  moved();
+  EXPECT_EQ(value, 5);
+}
+
+
+TEST(Task, DestroysCallable)
+{
+  auto counter = std::make_shared<int>(0);
+  {
+    task inline_task{ [counter] {} };
+    task heap_task{ [counter, padding = std::array<char, 128>{}] {} };
+    EXPECT_EQ(counter.use_count(), 3);
+
+    task assigned;
+    assigned = std::move(heap_task);
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
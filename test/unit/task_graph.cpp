@@ -0,0 +1,162 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file task_graph.cpp
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/pool.hpp>
+#include <parachute/task_graph.hpp>
+
+using namespace para;
+
+
+TEST(TaskGraph, Empty)
+{
+  using pool_type = static_pool<2>;
+
+  pool_type wp;
+
+  task_graph graph;
+
+  auto done = graph.run(wp);
+  ASSERT_TRUE(done.valid());
+  done.get();
+}
+
+
+TEST(TaskGraph, Diamond)
+{
+  using pool_type = static_pool<4>;
+
+  pool_type wp;
+
+  std::atomic<int> a = 0;
+  std::atomic<int> b = 0;
+  std::atomic<int> c = 0;
+  std::atomic<int> d = 0;
+
+  task_graph graph;
+  const auto top = graph.emplace([&] { a = 1; });
+  const auto left = graph.emplace([&] { b = a + 1; });
+  const auto right = graph.emplace([&] { c = a + 2; });
+  const auto bottom = graph.emplace([&] { d = b + c; });
+  graph.precede(top, left);
+  graph.precede(top, right);
+  graph.precede(left, bottom);
+  graph.precede(right, bottom);
+
+  ASSERT_EQ(graph.size(), 4UL);
+
+  auto done = graph.run(wp);
+  ASSERT_TRUE(done.wait_for(std::chrono::seconds(10)));
+  done.get();
+  EXPECT_EQ(d, 5);
+}
+
+
+TEST(TaskGraph, RunRepeatedly)
+{
+  using pool_type = pool_stealing;
+
+  pool_type wp;
+
+  static constexpr std::size_t kWidth = 8;
+  static constexpr std::size_t kDepth = 8;
+
+  std::vector<std::atomic<int>> counts(kWidth * kDepth);
+  std::atomic<bool> ordered = true;
+
+  task_graph graph;
+  for (std::size_t layer = 0; layer < kDepth; ++layer)
+  {
+    for (std::size_t i = 0; i < kWidth; ++i)
+    {
+      const std::size_t id = layer * kWidth + i;
+      graph.emplace([&counts, &ordered, id, layer, i] {
+        // Each node must run after both its predecessors in the previous layer, within the same run
+        if (layer > 0 and
+            (counts[id - kWidth] <= counts[id] or counts[(layer - 1) * kWidth + (i + 1) % kWidth] <= counts[id]))
+        {
+          ordered = false;
+        }
+        ++counts[id];
+      });
+      if (layer > 0)
+      {
+        graph.precede(id - kWidth, id);
+        graph.precede((layer - 1) * kWidth + (i + 1) % kWidth, id);
+      }
+    }
+  }
+
+  static constexpr int kRuns = 100;
+  for (int run = 0; run < kRuns; ++run)
+  {
+    auto done = graph.run(wp);
+    done.wait();
+    done.get();
+  }
+
+  EXPECT_TRUE(ordered);
+  for (const auto& count : counts)
+  {
+    EXPECT_EQ(count, kRuns);
+  }
+}
+
+
+TEST(TaskGraph, ExceptionSkipsRemainingNodes)
+{
+  using pool_type = static_pool<2>;
+
+  pool_type wp;
+
+  bool after_ran = false;
+
+  task_graph graph;
+  const auto first = graph.emplace([] { throw std::runtime_error{ "error" }; });
+  const auto after = graph.emplace([&after_ran] { after_ran = true; });
+  graph.precede(first, after);
+
+  auto failed = graph.run(wp);
+  failed.wait();
+  EXPECT_THROW(failed.get(), std::runtime_error);
+  EXPECT_FALSE(after_ran);
+}
+
+
+TEST(TaskGraph, AddNodesBetweenRuns)
+{
+  using pool_type = static_pool<2>;
+
+  pool_type wp;
+
+  std::atomic<int> calls = 0;
+
+  task_graph graph;
+  graph.emplace([&calls] { ++calls; });
+
+  auto first_run = graph.run(wp);
+  first_run.wait();
+  first_run.get();
+
+  const auto second = graph.emplace([&calls] { ++calls; });
+  graph.precede(0, second);
+
+  auto second_run = graph.run(wp);
+  second_run.wait();
+  second_run.get();
+
+  EXPECT_EQ(calls, 3);
+}
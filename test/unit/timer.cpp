@@ -0,0 +1,132 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file timer.cpp
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/pool.hpp>
+#include <parachute/timer.hpp>
+
+using namespace para;
+using namespace std::chrono_literals;
+
+
+TEST(Timer, PostAfter)
+{
+  pool_strict wp{ 2UL };
+  std::atomic<bool> done = false;
+
+  const auto posted_at = std::chrono::steady_clock::now();
+  std::atomic<std::chrono::steady_clock::time_point> ran_at;
+  auto handle = post_after(wp, 20ms, [&] {
+    ran_at = std::chrono::steady_clock::now();
+    done = true;
+  });
+  EXPECT_TRUE(handle.pending());
+
+  while (!done)
+  {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_GE(ran_at.load() - posted_at, 20ms);
+  EXPECT_FALSE(handle.pending());
+  EXPECT_FALSE(handle.cancel());
+}
+
+
+TEST(Timer, PostAt)
+{
+  pool_strict wp{ 2UL };
+  std::atomic<bool> done = false;
+
+  const auto deadline = std::chrono::system_clock::now() + 10ms;
+  auto handle = post_at(wp, deadline, [&done] { done = true; });
+  while (!done)
+  {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  // Timer may still be handing work off to the pool; cancelling waits for it to finish
+  EXPECT_FALSE(handle.cancel());
+}
+
+
+TEST(Timer, CancelBeforeFiring)
+{
+  std::atomic<bool> fired = false;
+  {
+    pool_strict wp{ 2UL };
+    auto handle = post_after(wp, 1h, [&fired] { fired = true; });
+    EXPECT_TRUE(handle.pending());
+    EXPECT_TRUE(handle.cancel());
+    EXPECT_FALSE(handle.pending());
+    EXPECT_FALSE(handle.cancel());
+  }
+  EXPECT_FALSE(fired);
+}
+
+
+TEST(Timer, PostEvery)
+{
+  pool_strict wp{ 2UL };
+  std::atomic<int> count = 0;
+
+  auto handle = post_every(wp, 2ms, [&count] { ++count; });
+  while (count < 5)
+  {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_TRUE(handle.cancel());
+
+  // Once cancelled, no more work is posted
+  std::this_thread::sleep_for(10ms);
+  const int after_cancel = count;
+  std::this_thread::sleep_for(20ms);
+  EXPECT_EQ(count, after_cancel);
+}
+
+
+TEST(Timer, ManyPendingTimers)
+{
+  constexpr std::size_t n = 100000;
+  timer_service timers;
+
+  std::vector<timer_handle> handles;
+  handles.reserve(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    const auto deadline = timer_service::clock::now() + std::chrono::seconds{ 1 + i % 3600 };
+    handles.push_back(timers.schedule(deadline, timer_service::clock::duration::zero(), [] {}));
+  }
+  EXPECT_EQ(timers.size(), n);
+
+  for (auto& handle : handles)
+  {
+    EXPECT_TRUE(handle.cancel());
+  }
+  EXPECT_EQ(timers.size(), 0UL);
+}
+
+
+TEST(Timer, ServiceDropsPendingTimers)
+{
+  std::atomic<bool> fired = false;
+  timer_handle handle;
+  {
+    timer_service timers;
+    handle = timers.schedule(timer_service::clock::now() + 1h, timer_service::clock::duration::zero(), [&fired] {
+      fired = true;
+    });
+  }
+  EXPECT_FALSE(fired);
+}
@@ -0,0 +1,137 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file timer_wheel.cpp
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/utility/timer_wheel.hpp>
+
+using namespace para::utility;
+
+
+TEST(TimerWheel, ExpiresInOrder)
+{
+  timer_wheel<> wheel;
+  std::vector<timer_wheel_node> nodes(4);
+  wheel.insert(nodes[0], 3);
+  wheel.insert(nodes[1], 1);
+  wheel.insert(nodes[2], 100);
+  wheel.insert(nodes[3], 5000);
+  EXPECT_EQ(wheel.size(), 4UL);
+  EXPECT_EQ(wheel.next_tick(), std::uint64_t{ 1 });
+
+  std::vector<std::uint64_t> fired;
+  const auto record = [&fired, &wheel](timer_wheel_node& node) {
+    EXPECT_EQ(node.expiry, wheel.now());
+    fired.push_back(node.expiry);
+  };
+
+  wheel.advance(2, record);
+  EXPECT_EQ(fired, (std::vector<std::uint64_t>{ 1 }));
+  wheel.advance(99, record);
+  EXPECT_EQ(fired, (std::vector<std::uint64_t>{ 1, 3 }));
+  wheel.advance(100000, record);
+  EXPECT_EQ(fired, (std::vector<std::uint64_t>{ 1, 3, 100, 5000 }));
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_FALSE(wheel.next_tick());
+  EXPECT_EQ(wheel.now(), 100000UL);
+}
+
+
+TEST(TimerWheel, PastExpiryFiresOnNextTick)
+{
+  timer_wheel<> wheel{ 10 };
+  timer_wheel_node node;
+  wheel.insert(node, 5);
+  EXPECT_EQ(node.expiry, 11UL);
+  EXPECT_EQ(wheel.next_tick(), std::uint64_t{ 11 });
+}
+
+
+TEST(TimerWheel, Erase)
+{
+  timer_wheel<> wheel;
+  timer_wheel_node kept;
+  timer_wheel_node erased;
+  wheel.insert(kept, 70);
+  wheel.insert(erased, 70);
+  wheel.erase(erased);
+  EXPECT_FALSE(erased.linked());
+
+  std::size_t n_fired = 0;
+  wheel.advance(70, [&n_fired, &kept](timer_wheel_node& node) {
+    EXPECT_EQ(&node, &kept);
+    ++n_fired;
+  });
+  EXPECT_EQ(n_fired, 1UL);
+}
+
+
+TEST(TimerWheel, BeyondSpan)
+{
+  timer_wheel<2, 2> wheel;
+  std::vector<timer_wheel_node> nodes(3);
+  wheel.insert(nodes[0], 15);
+  wheel.insert(nodes[1], 16);
+  wheel.insert(nodes[2], 1000);
+
+  std::vector<std::uint64_t> fired;
+  wheel.advance(2000, [&fired, &wheel](timer_wheel_node& node) {
+    EXPECT_EQ(node.expiry, wheel.now());
+    fired.push_back(node.expiry);
+  });
+  EXPECT_EQ(fired, (std::vector<std::uint64_t>{ 15, 16, 1000 }));
+}
+
+
+TEST(TimerWheel, ManyTimers)
+{
+  constexpr std::uint64_t n = 100000;
+  timer_wheel<> wheel;
+  std::vector<timer_wheel_node> nodes(n);
+  for (std::uint64_t i = 0; i < n; ++i)
+  {
+    wheel.insert(nodes[i], 1 + (i * 7919) % (n * 3));
+  }
+  // Cancel every other timer
+  for (std::uint64_t i = 0; i < n; i += 2)
+  {
+    wheel.erase(nodes[i]);
+  }
+  EXPECT_EQ(wheel.size(), n / 2);
+
+  std::uint64_t n_fired = 0;
+  std::uint64_t last = 0;
+  wheel.advance(n * 3, [&](timer_wheel_node& node) {
+    EXPECT_EQ(node.expiry, wheel.now());
+    EXPECT_GE(node.expiry, last);
+    last = node.expiry;
+    ++n_fired;
+  });
+  EXPECT_EQ(n_fired, n / 2);
+  EXPECT_TRUE(wheel.empty());
+}
+
+
+TEST(TimerWheel, ReinsertFromExpire)
+{
+  timer_wheel<> wheel;
+  timer_wheel_node node;
+  wheel.insert(node, 10);
+
+  std::size_t n_fired = 0;
+  wheel.advance(1000, [&](timer_wheel_node& expired) {
+    ++n_fired;
+    wheel.insert(expired, expired.expiry + 100);
+  });
+  EXPECT_EQ(n_fired, 10UL);
+  EXPECT_EQ(node.expiry, 1010UL);
+}
@@ -0,0 +1,107 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file trace.cpp
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/pool.hpp>
+#include <parachute/post.hpp>
+#include <parachute/trace.hpp>
+
+using namespace para;
+
+
+TEST(Trace, RingKeepsNewestEvents)
+{
+  detail::trace_ring ring{ 1 };
+  const std::uint64_t n = detail::trace_ring::capacity + 10;
+  for (std::uint64_t i = 0; i < n; ++i)
+  {
+    ring.push(detail::trace_event{ i, i, "event", detail::trace_event_type::enqueue });
+  }
+
+  std::vector<std::uint64_t> ids;
+  ring.for_each([&ids](const detail::trace_event& event) { ids.push_back(event.id); });
+
+  // Oldest events are overwritten; the one being written next is also dropped, since a reader could race with it
+  ASSERT_EQ(ids.size(), detail::trace_ring::capacity - 1);
+  EXPECT_EQ(ids.front(), n - detail::trace_ring::capacity + 1);
+  EXPECT_EQ(ids.back(), n - 1);
+}
+
+
+TEST(Trace, LabelledWorkRuns)
+{
+  int result = 0;
+  auto work = trace_label("label", [&result] { result = 1; });
+  work();
+  EXPECT_EQ(result, 1);
+  EXPECT_STREQ(detail::trace_label_of(work), "label");
+  EXPECT_STREQ(detail::trace_label_of([] {}), "task");
+}
+
+
+TEST(Trace, RecordsPoolEvents)
+{
+  std::atomic<int> done = 0;
+  {
+    pool_traced_strict wp{ 2UL };
+    wp.emplace(trace_label("trace-test-emplace", [&done] { ++done; }));
+    auto f = post(wp, trace_label("trace-test-post", [] { return 3; }));
+    EXPECT_EQ(f.get(), 3);
+  }
+  EXPECT_EQ(done.load(), 1);
+
+  std::ostringstream oss;
+  write_trace(oss);
+  const std::string trace = oss.str();
+
+  EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0UL);
+  EXPECT_NE(trace.find("{\"name\":\"trace-test-emplace\",\"cat\":\"parachute\",\"ph\":\"B\""), std::string::npos);
+  EXPECT_NE(trace.find("{\"name\":\"trace-test-emplace\",\"cat\":\"parachute\",\"ph\":\"E\""), std::string::npos);
+  EXPECT_NE(trace.find("{\"name\":\"trace-test-post\",\"cat\":\"parachute\",\"ph\":\"s\""), std::string::npos);
+  EXPECT_NE(trace.find("{\"name\":\"trace-test-post\",\"cat\":\"parachute\",\"ph\":\"f\""), std::string::npos);
+  EXPECT_NE(trace.find("{\"name\":\"emplace\",\"cat\":\"parachute\",\"ph\":\"B\""), std::string::npos);
+  EXPECT_NE(trace.find("{\"name\":\"idle\",\"cat\":\"parachute\",\"ph\":\"B\""), std::string::npos);
+  EXPECT_NE(trace.find("\"ph\":\"M\""), std::string::npos);
+}
+
+
+TEST(Trace, UntracedPoolRecordsNothing)
+{
+  {
+    pool_strict wp{ 2UL };
+    wp.emplace(trace_label("trace-test-untraced", [] {}));
+  }
+
+  std::ostringstream oss;
+  write_trace(oss);
+  EXPECT_EQ(oss.str().find("trace-test-untraced"), std::string::npos);
+}
+
+
+TEST(Trace, EscapesLabels)
+{
+  std::ostringstream oss;
+  detail::write_json_string(oss, "a\"b\\c\n");
+  EXPECT_EQ(oss.str(), "\"a\\\"b\\\\c\\u000a\"");
+}
+
+
+TEST(Trace, DumpTrace)
+{
+  EXPECT_TRUE(dump_trace(::testing::TempDir() + "parachute_trace.json"));
+  EXPECT_FALSE(dump_trace(::testing::TempDir() + "no/such/directory/parachute_trace.json"));
+}
@@ -0,0 +1,239 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file when.cpp
+ */
+
+// C++ Standard Library
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/pool.hpp>
+#include <parachute/post.hpp>
+#include <parachute/when.hpp>
+
+using namespace para;
+
+
+TEST(WhenAll, VariadicValues)
+{
+  non_blocking_promise<int> a;
+  non_blocking_promise<std::string> b;
+  non_blocking_promise<void> c;
+
+  auto all = when_all(a.get_future(), b.get_future(), c.get_future());
+  static_assert(std::is_same_v<decltype(all), non_blocking_future<std::tuple<int, std::string>>>);
+
+  b.set_value("b");
+  c.set_value();
+  EXPECT_FALSE(all.valid());
+  a.set_value(1);
+  ASSERT_TRUE(all.valid());
+  EXPECT_EQ(all.get(), std::make_tuple(1, std::string{ "b" }));
+}
+
+
+TEST(WhenAll, VariadicVoid)
+{
+  non_blocking_promise<void> a;
+  non_blocking_promise<void> b;
+
+  auto all = when_all(a.get_future(), b.get_future());
+  static_assert(std::is_same_v<decltype(all), non_blocking_future<void>>);
+
+  a.set_value();
+  EXPECT_FALSE(all.valid());
+  b.set_value();
+  ASSERT_TRUE(all.valid());
+  all.get();
+}
+
+
+TEST(WhenAll, VariadicException)
+{
+  non_blocking_promise<int> a;
+  non_blocking_promise<int> b;
+
+  auto all = when_all(a.get_future(), b.get_future());
+
+  a.set_exception(std::make_exception_ptr(std::runtime_error{ "error" }));
+  EXPECT_FALSE(all.valid());
+  b.set_value(2);
+  ASSERT_TRUE(all.valid());
+  EXPECT_THROW(all.get(), std::runtime_error);
+}
+
+
+TEST(WhenAll, RangeMoveOnlyValues)
+{
+  std::vector<non_blocking_promise<std::unique_ptr<int>>> promises(10);
+  std::vector<non_blocking_future<std::unique_ptr<int>>> futures;
+  for (auto& promise : promises)
+  {
+    futures.push_back(promise.get_future());
+  }
+
+  auto all = when_all(futures.begin(), futures.end());
+  for (int i = static_cast<int>(promises.size()) - 1; i >= 0; --i)
+  {
+    EXPECT_FALSE(all.valid());
+    promises[i].set_value(std::make_unique<int>(i));
+  }
+
+  ASSERT_TRUE(all.valid());
+  const auto values = all.get();
+  ASSERT_EQ(values.size(), promises.size());
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    EXPECT_EQ(*values[i], static_cast<int>(i));
+  }
+}
+
+
+TEST(WhenAll, RangeEmpty)
+{
+  std::vector<non_blocking_future<int>> futures;
+
+  auto all = when_all(futures.begin(), futures.end());
+  ASSERT_TRUE(all.valid());
+  EXPECT_TRUE(all.get().empty());
+}
+
+
+TEST(WhenAll, RangeBrokenPromise)
+{
+  auto promise = std::make_unique<non_blocking_promise<void>>();
+  std::vector<non_blocking_future<void>> futures;
+  futures.push_back(promise->get_future());
+
+  auto all = when_all(futures.begin(), futures.end());
+  promise.reset();
+  ASSERT_TRUE(all.valid());
+  EXPECT_THROW(all.get(), non_blocking_future_error);
+}
+
+
+TEST(WhenAll, RangeFromPool)
+{
+  using pool_type = pool;
+
+  pool_type wp;
+
+  std::vector<non_blocking_future<std::size_t>> futures;
+  for (std::size_t i = 0; i < 1000; ++i)
+  {
+    futures.push_back(post<strategy::non_blocking>(wp, [i] { return i; }));
+  }
+
+  auto all = when_all(futures.begin(), futures.end());
+  ASSERT_TRUE(all.wait_for(std::chrono::seconds(10)));
+
+  const auto values = all.get();
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    ASSERT_EQ(values[i], i);
+  }
+}
+
+
+TEST(WhenAny, VariadicFirstValueWins)
+{
+  non_blocking_promise<int> a;
+  non_blocking_promise<int> b;
+  non_blocking_promise<int> c;
+
+  auto any = when_any(a.get_future(), b.get_future(), c.get_future());
+
+  EXPECT_FALSE(any.valid());
+  b.set_value(2);
+  a.set_value(1);
+  ASSERT_TRUE(any.valid());
+
+  const auto result = any.get();
+  EXPECT_EQ(result.index, 1UL);
+  EXPECT_EQ(result.value, 2);
+  c.set_value(3);
+}
+
+
+TEST(WhenAny, VariadicVoid)
+{
+  non_blocking_promise<void> a;
+  non_blocking_promise<void> b;
+
+  auto any = when_any(a.get_future(), b.get_future());
+  static_assert(std::is_same_v<decltype(any), non_blocking_future<std::size_t>>);
+
+  b.set_value();
+  ASSERT_TRUE(any.valid());
+  EXPECT_EQ(any.get(), 1UL);
+  a.set_value();
+}
+
+
+TEST(WhenAny, RangeException)
+{
+  std::vector<non_blocking_promise<int>> promises(3);
+  std::vector<non_blocking_future<int>> futures;
+  for (auto& promise : promises)
+  {
+    futures.push_back(promise.get_future());
+  }
+
+  auto any = when_any(futures.begin(), futures.end());
+  promises[2].set_exception(std::make_exception_ptr(std::runtime_error{ "error" }));
+  promises[0].set_value(0);
+  ASSERT_TRUE(any.valid());
+  EXPECT_THROW(any.get(), std::runtime_error);
+}
+
+
+TEST(WhenAny, RangeEmpty)
+{
+  std::vector<non_blocking_future<int>> futures;
+
+  auto any = when_any(futures.begin(), futures.end());
+  ASSERT_TRUE(any.valid());
+  EXPECT_THROW(any.get(), non_blocking_future_error);
+}
+
+
+TEST(WhenAny, RangeFromThreads)
+{
+  for (int repeat = 0; repeat < 100; ++repeat)
+  {
+    std::vector<non_blocking_promise<int>> promises(4);
+    std::vector<non_blocking_future<int>> futures;
+    for (auto& promise : promises)
+    {
+      futures.push_back(promise.get_future());
+    }
+
+    auto any = when_any(futures.begin(), futures.end());
+
+    std::vector<std::thread> setters;
+    for (int i = 0; i < static_cast<int>(promises.size()); ++i)
+    {
+      setters.emplace_back([&promises, i] { promises[i].set_value(int{ i }); });
+    }
+
+    any.wait();
+    const auto result = any.get();
+    EXPECT_EQ(result.value, static_cast<int>(result.index));
+
+    for (auto& setter : setters)
+    {
+      setter.join();
+    }
+  }
+}
@@ -0,0 +1,127 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file work_group_elastic.cpp
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/pool.hpp>
+
+using namespace para;
+
+
+/// Waits up to \c timeout for \c condition to hold
+template <typename ConditionT> static bool eventually(ConditionT condition, const std::chrono::seconds timeout)
+{
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (!condition())
+  {
+    if (std::chrono::steady_clock::now() > deadline)
+    {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+  }
+  return true;
+}
+
+
+TEST(WorkGroupElastic, StartsWithMinWorkers)
+{
+  pool_elastic wp{ 2UL, 4UL };
+  EXPECT_EQ(wp.size(), 2UL);
+}
+
+
+TEST(WorkGroupElastic, GrowsWhileWorkBacksUp)
+{
+  std::atomic<bool> release = false;
+  std::atomic<int> running = 0;
+  {
+    pool_elastic wp{ 1UL, 4UL, std::chrono::milliseconds{ 1000 } };
+    for (int i = 0; i < 4; ++i)
+    {
+      wp.emplace([&release, &running] {
+        ++running;
+        while (!release.load())
+        {
+          std::this_thread::yield();
+        }
+      });
+    }
+
+    // Every job blocks its worker, so all jobs only run at once if a worker was added for each
+    EXPECT_TRUE(eventually([&running] { return running.load() == 4; }, std::chrono::seconds{ 10 }));
+    EXPECT_EQ(wp.size(), 4UL);
+    release = true;
+  }
+  EXPECT_EQ(running.load(), 4);
+}
+
+
+TEST(WorkGroupElastic, NeverExceedsMaxWorkers)
+{
+  std::atomic<int> done = 0;
+  {
+    pool_elastic_strict wp{ 1UL, 3UL, std::chrono::milliseconds{ 1000 } };
+    for (int i = 0; i < 100; ++i)
+    {
+      wp.emplace([&done] {
+        std::this_thread::sleep_for(std::chrono::microseconds{ 100 });
+        ++done;
+      });
+      EXPECT_LE(wp.size(), 3UL);
+    }
+  }
+  EXPECT_EQ(done.load(), 100);
+}
+
+
+TEST(WorkGroupElastic, RetiresIdleWorkersDownToMin)
+{
+  std::atomic<bool> release = false;
+  pool_elastic wp{ 1UL, 3UL, std::chrono::milliseconds{ 10 } };
+  for (int i = 0; i < 3; ++i)
+  {
+    wp.emplace([&release] {
+      while (!release.load())
+      {
+        std::this_thread::yield();
+      }
+    });
+  }
+  EXPECT_TRUE(eventually([&wp] { return wp.size() == 3UL; }, std::chrono::seconds{ 10 }));
+  release = true;
+
+  EXPECT_TRUE(eventually([&wp] { return wp.size() == 1UL; }, std::chrono::seconds{ 10 }));
+
+  // Remaining worker still runs work, and the pool grows again on demand
+  std::atomic<bool> ran = false;
+  wp.emplace([&ran] { ran = true; });
+  EXPECT_TRUE(eventually([&ran] { return ran.load(); }, std::chrono::seconds{ 10 }));
+}
+
+
+TEST(WorkGroupElastic, EmplaceFromJobsDuringShutdown)
+{
+  std::atomic<int> done = 0;
+  {
+    pool_elastic_strict wp{ 1UL, 4UL, std::chrono::milliseconds{ 1 } };
+    for (int i = 0; i < 16; ++i)
+    {
+      wp.emplace([&wp, &done] {
+        wp.emplace([&done] { ++done; });
+        ++done;
+      });
+    }
+  }
+  EXPECT_EQ(done.load(), 32);
+}
@@ -0,0 +1,158 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file work_group_pinned.cpp
+ */
+
+// C++ Standard Library
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/non_blocking_future.hpp>
+#include <parachute/pool.hpp>
+#include <parachute/post.hpp>
+#include <parachute/utility/cpu_topology.hpp>
+#include <parachute/work_group/pinned.hpp>
+
+using namespace para;
+
+
+/// Returns CPU numbers of each entry in \c cpus, in order
+static std::vector<unsigned> cpu_numbers(const std::vector<utility::cpu_info>& cpus)
+{
+  std::vector<unsigned> numbers;
+  for (const auto& info : cpus)
+  {
+    numbers.push_back(info.cpu);
+  }
+  return numbers;
+}
+
+
+/// Two packages, each with two cores of two SMT siblings; sibling of CPU n is CPU n + 4
+static std::vector<utility::cpu_info> two_package_topology()
+{
+  return {
+    { 0, 0, 0, 0 }, { 1, 1, 0, 0 }, { 2, 0, 1, 1 }, { 3, 1, 1, 1 },
+    { 4, 0, 0, 0 }, { 5, 1, 0, 0 }, { 6, 0, 1, 1 }, { 7, 1, 1, 1 },
+  };
+}
+
+
+TEST(CpuTopology, ParseCpuList)
+{
+  EXPECT_EQ(utility::parse_cpu_list("0"), (std::vector<unsigned>{ 0 }));
+  EXPECT_EQ(utility::parse_cpu_list("0-3,8,10-11"), (std::vector<unsigned>{ 0, 1, 2, 3, 8, 10, 11 }));
+  EXPECT_TRUE(utility::parse_cpu_list("").empty());
+  EXPECT_TRUE(utility::parse_cpu_list("3-1").empty());
+  EXPECT_TRUE(utility::parse_cpu_list("a").empty());
+}
+
+
+TEST(CpuTopology, ReadFromSysfs)
+{
+  namespace fs = std::filesystem;
+
+  const fs::path root = fs::temp_directory_path() / "parachute_cpu_topology_test";
+  const auto write = [&root](const std::string& path, const std::string& content) {
+    fs::create_directories((root / path).parent_path());
+    std::ofstream{ root / path } << content << '\n';
+  };
+
+  write("cpu/online", "0-3");
+  for (unsigned cpu = 0; cpu < 4; ++cpu)
+  {
+    write("cpu/cpu" + std::to_string(cpu) + "/topology/core_id", std::to_string(cpu % 2));
+    write("cpu/cpu" + std::to_string(cpu) + "/topology/physical_package_id", std::to_string(cpu / 2));
+  }
+  write("node/online", "0-1");
+  write("node/node0/cpulist", "0-1");
+  write("node/node1/cpulist", "2-3");
+
+  const auto topology = utility::read_cpu_topology(root.string());
+  fs::remove_all(root);
+
+  ASSERT_EQ(topology.size(), 4UL);
+  for (unsigned cpu = 0; cpu < 4; ++cpu)
+  {
+    EXPECT_EQ(topology[cpu].cpu, cpu);
+    EXPECT_EQ(topology[cpu].core, cpu % 2);
+    EXPECT_EQ(topology[cpu].package, cpu / 2);
+    EXPECT_EQ(topology[cpu].numa_node, cpu / 2);
+  }
+}
+
+
+TEST(CpuTopology, MissingSysfsFallsBack)
+{
+  const auto topology = utility::read_cpu_topology("/nonexistent");
+  ASSERT_FALSE(topology.empty());
+  EXPECT_EQ(topology.front().cpu, 0U);
+}
+
+
+TEST(CpuPlacement, Compact)
+{
+  EXPECT_EQ(
+    cpu_numbers(detail::order_cpus(two_package_topology(), cpu_placement::compact)),
+    (std::vector<unsigned>{ 0, 4, 1, 5, 2, 6, 3, 7 }));
+  EXPECT_EQ(
+    cpu_numbers(detail::order_cpus(two_package_topology(), cpu_placement::compact_no_smt)),
+    (std::vector<unsigned>{ 0, 1, 2, 3 }));
+}
+
+
+TEST(CpuPlacement, Scatter)
+{
+  EXPECT_EQ(
+    cpu_numbers(detail::order_cpus(two_package_topology(), cpu_placement::scatter)),
+    (std::vector<unsigned>{ 0, 2, 1, 3, 4, 6, 5, 7 }));
+  EXPECT_EQ(
+    cpu_numbers(detail::order_cpus(two_package_topology(), cpu_placement::scatter_no_smt)),
+    (std::vector<unsigned>{ 0, 2, 1, 3 }));
+}
+
+
+TEST(WorkGroupPinned, WorkerKnowsItsCpu)
+{
+  EXPECT_FALSE(this_worker::cpu().has_value());
+
+  pool_pinned wp{ std::size_t{ 2 }, cpu_placement::scatter };
+
+#if defined(__linux__)
+  // Reported CPU, and the CPU the worker actually runs on, are both read on the worker
+  auto cpu = post<strategy::non_blocking>(wp, [] { return std::make_pair(this_worker::cpu(), ::sched_getcpu()); });
+  cpu.wait();
+  const auto [info, running_on] = cpu.get();
+  ASSERT_TRUE(info.has_value());
+  EXPECT_EQ(static_cast<int>(info->cpu), running_on);
+#else
+  auto cpu = post<strategy::non_blocking>(wp, [] { return this_worker::cpu(); });
+  cpu.wait();
+  EXPECT_FALSE(cpu.get().has_value());
+#endif  // defined(__linux__)
+}
+
+
+TEST(WorkGroupPinned, ExplicitCpuList)
+{
+  const auto first_cpu = detail::allowed_cpus(utility::read_cpu_topology()).front().cpu;
+
+  pool_pinned wp{ std::vector<unsigned>{ first_cpu, first_cpu } };
+  EXPECT_EQ(wp.size(), 2UL);
+
+  auto cpu = post<strategy::non_blocking>(wp, [] { return this_worker::cpu(); });
+  cpu.wait();
+  const auto info = cpu.get();
+#if defined(__linux__)
+  ASSERT_TRUE(info.has_value());
+  EXPECT_EQ(info->cpu, first_cpu);
+#endif  // defined(__linux__)
+}
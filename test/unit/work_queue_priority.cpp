@@ -0,0 +1,120 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file work_queue_priority.cpp
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/non_blocking_future.hpp>
+#include <parachute/pool.hpp>
+#include <parachute/post.hpp>
+
+using namespace para;
+
+
+TEST(WorkQueuePriority, PopsMostUrgentLevelFirst)
+{
+  std::vector<int> order;
+
+  work_queue_priority<3> queue;
+  queue.enqueue([&order] { order.push_back(2); });
+  queue.enqueue([&order] { order.push_back(1); }, 1);
+  queue.enqueue([&order] { order.push_back(0); }, 0);
+  queue.enqueue([&order] { order.push_back(3); });
+  queue.enqueue([&order] { order.push_back(4); }, 100);
+
+  while (!queue.empty())
+  {
+    queue.pop()();
+  }
+
+  EXPECT_EQ(order, (std::vector<int>{ 0, 1, 2, 3, 4 }));
+}
+
+
+TEST(WorkQueuePriority, StrictPriorityStarvesLowLevel)
+{
+  std::vector<int> order;
+
+  work_queue_priority<2> queue;
+  queue.enqueue([&order] { order.push_back(1); });
+  for (int i = 0; i < 4; ++i)
+  {
+    queue.enqueue([&order] { order.push_back(0); }, 0);
+  }
+
+  while (!queue.empty())
+  {
+    queue.pop()();
+  }
+
+  EXPECT_EQ(order, (std::vector<int>{ 0, 0, 0, 0, 1 }));
+}
+
+
+TEST(WorkQueuePriority, AgingPromotesLowLevel)
+{
+  std::vector<int> order;
+
+  work_queue_priority<2, 2> queue;
+  queue.enqueue([&order] { order.push_back(1); });
+  for (int i = 0; i < 8; ++i)
+  {
+    queue.enqueue([&order] { order.push_back(0); }, 0);
+  }
+
+  // Second pop ages the low-priority job to the back of the urgent level
+  queue.pop()();
+  queue.pop()();
+
+  for (int i = 0; i < 8; ++i)
+  {
+    queue.enqueue([&order] { order.push_back(0); }, 0);
+  }
+  while (!queue.empty())
+  {
+    queue.pop()();
+  }
+
+  // Once aged, the low-priority job runs ahead of urgent work enqueued after it
+  ASSERT_EQ(order.size(), 17UL);
+  EXPECT_EQ(order[8], 1);
+}
+
+
+TEST(WorkQueuePriority, UrgentPostRunsBeforeQueuedBackgroundWork)
+{
+  using pool_type = pool_base<work_group_static<1>, work_queue_priority<2>, work_control_strict>;
+
+  std::promise<void> release;
+  std::atomic<int> background_done = 0;
+  std::atomic<int> background_done_before_urgent = -1;
+  {
+    pool_type wp;
+
+    // Occupies the only worker until all other work is queued
+    wp.emplace([f = release.get_future().share()] { f.wait(); });
+    for (int i = 0; i < 16; ++i)
+    {
+      wp.emplace([&background_done] { ++background_done; });
+    }
+    auto urgent = post<strategy::non_blocking>(
+      wp, [&] { background_done_before_urgent = background_done.load(); }, 0);
+
+    release.set_value();
+    urgent.wait();
+    urgent.get();
+  }
+
+  EXPECT_EQ(background_done_before_urgent, 0);
+  EXPECT_EQ(background_done, 16);
+}
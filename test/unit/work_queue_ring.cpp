@@ -0,0 +1,156 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file work_queue_ring.cpp
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/work_queue/ring.hpp>
+
+using namespace para;
+
+
+TEST(WorkQueueRing, PopsInFifoOrder)
+{
+  std::vector<int> order;
+
+  work_queue_ring<8> queue;
+  for (int i = 0; i < 5; ++i)
+  {
+    queue.enqueue([&order, i] { order.push_back(i); });
+  }
+
+  while (auto job = queue.try_pop())
+  {
+    (*job)();
+  }
+
+  EXPECT_EQ(order, (std::vector<int>{ 0, 1, 2, 3, 4 }));
+}
+
+
+TEST(WorkQueueRing, Empty)
+{
+  work_queue_ring<4> queue;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.try_pop().has_value());
+
+  queue.enqueue([] {});
+  EXPECT_FALSE(queue.empty());
+
+  auto job = queue.try_pop();
+  ASSERT_TRUE(job.has_value());
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.try_pop().has_value());
+}
+
+
+TEST(WorkQueueRing, FullQueueWaitsForConsumer)
+{
+  static constexpr int kCount = 1000;
+  std::vector<int> order;
+
+  // Far more jobs than slots, so the producer waits on a full queue, and slot sequences wrap many times
+  work_queue_ring<4> queue;
+  std::thread consumer{ [&queue, &order] {
+    while (order.size() < static_cast<std::size_t>(kCount))
+    {
+      if (auto job = queue.try_pop())
+      {
+        (*job)();
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+  } };
+
+  for (int i = 0; i < kCount; ++i)
+  {
+    queue.enqueue([&order, i] { order.push_back(i); });
+  }
+  consumer.join();
+
+  ASSERT_EQ(order.size(), static_cast<std::size_t>(kCount));
+  for (int i = 0; i < kCount; ++i)
+  {
+    ASSERT_EQ(order[static_cast<std::size_t>(i)], i);
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+
+TEST(WorkQueueRing, DtorReleasesUnrunWork)
+{
+  auto resource = std::make_shared<int>(1);
+  const std::weak_ptr<int> observer = resource;
+  {
+    work_queue_ring<4> queue;
+    queue.enqueue([r = std::make_unique<std::shared_ptr<int>>(std::move(resource))] {});
+    queue.enqueue([r = std::make_unique<int>(2)] {});
+    EXPECT_FALSE(observer.expired());
+  }
+  EXPECT_TRUE(observer.expired());
+}
+
+
+TEST(WorkQueueRing, MultiProducerMultiConsumer)
+{
+  static constexpr std::size_t kProducers = 4;
+  static constexpr std::size_t kConsumers = 4;
+  static constexpr std::size_t kPerProducer = 10000;
+  static constexpr std::size_t kCount = kProducers * kPerProducer;
+
+  std::vector<std::atomic<int>> runs(kCount);
+  std::atomic<std::size_t> popped = 0;
+
+  work_queue_ring<64> queue;
+  std::vector<std::thread> threads;
+  for (std::size_t c = 0; c < kConsumers; ++c)
+  {
+    threads.emplace_back([&queue, &popped] {
+      while (popped.load() < kCount)
+      {
+        if (auto job = queue.try_pop())
+        {
+          (*job)();
+          ++popped;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (std::size_t p = 0; p < kProducers; ++p)
+  {
+    threads.emplace_back([&queue, &runs, p] {
+      for (std::size_t i = p * kPerProducer; i < (p + 1) * kPerProducer; ++i)
+      {
+        queue.enqueue([&runs, i] { ++runs[i]; });
+      }
+    });
+  }
+  for (auto& t : threads)
+  {
+    t.join();
+  }
+
+  for (std::size_t i = 0; i < kCount; ++i)
+  {
+    ASSERT_EQ(runs[i].load(), 1) << "item " << i;
+  }
+  EXPECT_TRUE(queue.empty());
+}
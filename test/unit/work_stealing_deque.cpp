@@ -0,0 +1,144 @@
+/**
+ * @copyright 2023-present Brian Cairl
+ *
+ * @file work_stealing_deque.cpp
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Parachute
+#include <parachute/utility/work_stealing_deque.hpp>
+
+using namespace para::utility;
+
+
+TEST(WorkStealingDeque, PopIsLifo)
+{
+  work_stealing_deque<int> deque;
+  for (int i = 0; i < 5; ++i)
+  {
+    deque.push(i);
+  }
+
+  int value = -1;
+  for (int i = 4; i >= 0; --i)
+  {
+    ASSERT_TRUE(deque.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(deque.pop(value));
+  EXPECT_TRUE(deque.empty());
+}
+
+
+TEST(WorkStealingDeque, StealIsFifo)
+{
+  work_stealing_deque<int> deque;
+  for (int i = 0; i < 5; ++i)
+  {
+    deque.push(i);
+  }
+
+  int value = -1;
+  for (int i = 0; i < 5; ++i)
+  {
+    ASSERT_TRUE(deque.steal(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(deque.steal(value));
+  EXPECT_TRUE(deque.empty());
+}
+
+
+TEST(WorkStealingDeque, GrowsPastInitialCapacity)
+{
+  static constexpr int kCount = 1000;
+
+  work_stealing_deque<int> deque{ 4 };
+
+  // Steal some values first, so that live values straddle the end of the initial ring when it grows
+  for (int i = 0; i < 3; ++i)
+  {
+    deque.push(i);
+  }
+  int value = -1;
+  ASSERT_TRUE(deque.steal(value));
+  ASSERT_TRUE(deque.steal(value));
+  for (int i = 3; i < kCount; ++i)
+  {
+    deque.push(i);
+  }
+
+  ASSERT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 2);
+  for (int i = kCount - 1; i >= 3; --i)
+  {
+    ASSERT_TRUE(deque.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_TRUE(deque.empty());
+}
+
+
+TEST(WorkStealingDeque, OwnerPopRacesThieves)
+{
+  static constexpr std::size_t kThieves = 3;
+  static constexpr std::size_t kCount = 100000;
+
+  std::vector<std::atomic<int>> taken(kCount);
+  std::atomic<bool> done = false;
+
+  // Small initial capacity, so that the ring also grows while thieves are stealing
+  work_stealing_deque<std::size_t> deque{ 2 };
+
+  std::vector<std::thread> thieves;
+  for (std::size_t t = 0; t < kThieves; ++t)
+  {
+    thieves.emplace_back([&deque, &taken, &done] {
+      std::size_t value = 0;
+      while (!done.load() or !deque.empty())
+      {
+        if (deque.steal(value))
+        {
+          ++taken[value];
+        }
+      }
+    });
+  }
+
+  // Pushes in short bursts, then pops until empty, so that the owner often races thieves for the last value
+  std::size_t next = 0;
+  while (next < kCount)
+  {
+    const std::size_t burst = 1 + next % 7;
+    for (std::size_t i = 0; i < burst and next < kCount; ++i)
+    {
+      deque.push(next++);
+    }
+    std::size_t value = 0;
+    while (!deque.empty())
+    {
+      if (deque.pop(value))
+      {
+        ++taken[value];
+      }
+    }
+  }
+  done = true;
+  for (auto& t : thieves)
+  {
+    t.join();
+  }
+
+  for (std::size_t i = 0; i < kCount; ++i)
+  {
+    ASSERT_EQ(taken[i].load(), 1) << "item " << i;
+  }
+}